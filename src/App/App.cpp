@@ -10,16 +10,8 @@
 #include <iostream>
 
 #include "App/App_Globals.hpp"
-
-// FPS tracking: count rendered frames over a 0.5-second window
-int   fpsFrameCount  = 0;
-float fpsAccum       = 0.f;
-float displayFPS     = 0.f;
-
-// UPS tracking: count world.tick() calls (weighted by simSpeed) per second
-int   upsTickCount   = 0;
-float upsAccum       = 0.f;
-float displayUPS     = 0.f;
+#include "Core/Profiler.hpp"
+#include "Core/Trace.hpp"
 
 int RunApplication()
 {
@@ -146,6 +138,13 @@ int RunApplication()
     // ── Load default settings ─────────────────────────────────────────────────
     g_ui.loadSettingsFromFile("default.json", g_world, g_renderer);
 
+    // ── Trace recorder ────────────────────────────────────────────────────────
+    // Always on in every build: a few ns per scope keeps the last minute or
+    // so of frames on hand, which the Profiler panel dumps on demand, on a
+    // slow frame, or at exit.
+    trace().start();
+    trace().nameThread("main");
+
     // ── Main loop ─────────────────────────────────────────────────────────────
     // Uses std::chrono::high_resolution_clock for sub-millisecond frame timing.
     // dt is capped at 50 ms (20 FPS minimum) to prevent the simulation from
@@ -202,80 +201,21 @@ int RunApplication()
         float raw_dt = dt;                 // true frame time, uncapped
         dt = std::min(dt, 0.05f);         // capped for simulation stability
 
-        // ── FPS / UPS counters with 1% low tracking ─────────────────────────────
-        // Ring buffer stores instantaneous frame rates for 1% low calculation.
-        // Uses raw_dt (uncapped) so genuine stutter frames are captured.
-        static constexpr int PERF_RING = 120;          // 60 would be at 60fps 1 second
-        static float s_fpsBuf[PERF_RING] = {};
-        static float s_upsBuf[PERF_RING] = {};
-        static int   s_perfHead  = 0;
-        static int   s_perfCount = 0;
-
-        {
-            static int   fpsFrameCount = 0;
-            static float fpsAccum      = 0.f;
-
-            // Instantaneous FPS from raw (uncapped) frame time
-            float instFPS = (raw_dt > 1e-6f) ? (1.f / raw_dt) : 9999.f;
-            s_fpsBuf[s_perfHead] = instFPS;
-            // Note: perfHead is advanced in the UPS block below so both buffers stay in sync
-
-            fpsFrameCount++;
-            fpsAccum += raw_dt;
-            if (fpsAccum >= 0.5f) {
-                g_ui.displayFPS = (float)fpsFrameCount / fpsAccum;
-                fpsFrameCount   = 0;
-                fpsAccum        = 0.f;
-
-                // Recompute 1% lows every 0.5s (cheap: only when display updates)
-                if (s_perfCount > 0) {
-                    // Copy valid portion and partial-sort for 1st percentile
-                    static float tmpF[PERF_RING], tmpU[PERF_RING];
-                    int n = s_perfCount;
-                    for (int i = 0; i < n; i++) {
-                        tmpF[i] = s_fpsBuf[i];
-                        tmpU[i] = s_upsBuf[i];
-                    }
-                    int kf = std::max(0, (int)(0.01f * n));
-                    int ku = std::max(0, (int)(0.01f * n));
-                    std::nth_element(tmpF, tmpF + kf, tmpF + n);
-                    std::nth_element(tmpU, tmpU + ku, tmpU + n);
-                    g_ui.onePctLowFPS = tmpF[kf];
-                    g_ui.onePctLowUPS = tmpU[ku];
-                }
-            }
-        }
-
         // ── Update simulation and recording ─────────────────────────────────
         g_renderer.selectedID = g_ui.selectedID;
         g_renderer.tickCamera(dt, g_world);
-        g_planet.update(g_renderer.camera);
+        {
+            PROFILE_SCOPE(PROF_QUADTREE);
+            g_planet.update(g_renderer.camera);
+        }
         g_world.tick(dt);
-        g_recorder.tick(dt, g_world);
-
-        // ── UPS counter ─────────────────────────────────────────────────────────
         {
-            static int   upsTickCount = 0;
-            static float upsAccum     = 0.f;
-
-            // Store instantaneous UPS in ring buffer (same slot as FPS this frame).
-            // UPS ≈ FPS when not paused; 0 when paused.
-            float instUPS = (!g_world.cfg.paused && raw_dt > 1e-6f)
-                          ? (1.f / raw_dt) : 0.f;
-            s_upsBuf[s_perfHead] = instUPS;
-
-            // Advance the ring buffer head now that both FPS and UPS are written
-            s_perfHead = (s_perfHead + 1) % PERF_RING;
-            s_perfCount = std::min(s_perfCount + 1, PERF_RING);
-
-            if (!g_world.cfg.paused) {
-                upsTickCount++;
-                upsAccum += raw_dt;
-            }
-            if (upsAccum >= 0.5f) {
-                g_ui.displayUPS = (float)upsTickCount / upsAccum;
-                upsTickCount    = 0;
-                upsAccum        = 0.f;
+            PROFILE_SCOPE(PROF_RECORDING);
+            g_recorder.tick(dt, g_world);
+            g_loader.step(g_world);          // plants stream in after a sectioned load
+            if (!g_loader.active()) {        // never snapshot a half-loaded world
+                g_saver.tick(raw_dt, g_world);   // autosave snapshots at this tick boundary
+                g_rewind.tick(g_world);          // rewind frames are captured here too
             }
         }
 
@@ -306,66 +246,79 @@ int RunApplication()
         // (instanced triangle strips with alpha blending).
         float aspect = vp.Width / std::max(vp.Height, 1.f);
 
-        // ── 3-D render passes ──────────────────────────────────────────────────
-        // Planet terrain + atmosphere (PlanetRenderer, uses its own far-Z)
-        g_planet.render(g_world, g_renderer, aspect);
-
-        // Clear depth so creatures and FOV cone draw on top of the planet
-        // if (g_renderer.depthDSV)
-        //     g_pd3dDeviceContext->ClearDepthStencilView(
-        //         g_renderer.depthDSV.Get(), D3D11_CLEAR_DEPTH, 1.f, 0);
-
-        // Creature billboards + FOV cone (Renderer, uses creature positions
-        //    which are now 3-D sphere-surface points).
-        //    We call renderCreaturesAndOverlays() — a new thin wrapper that skips
-        //    flat terrain and water and only draws creatures + FOV.
-        //    Fallback: call render() with waterBuilt=true so water is skipped,
-        //    and with chunk meshes having 0 indices (they were never built).
-        g_renderer.render(g_world, aspect);
+        {
+            PROFILE_SCOPE(PROF_RENDER);
+
+            // ── 3-D render passes ──────────────────────────────────────────────────
+            // Planet terrain + atmosphere (PlanetRenderer, uses its own far-Z)
+            g_planet.render(g_world, g_renderer, aspect);
+
+            // Clear depth so creatures and FOV cone draw on top of the planet
+            // if (g_renderer.depthDSV)
+            //     g_pd3dDeviceContext->ClearDepthStencilView(
+            //         g_renderer.depthDSV.Get(), D3D11_CLEAR_DEPTH, 1.f, 0);
+
+            // Creature billboards + FOV cone (Renderer, uses creature positions
+            //    which are now 3-D sphere-surface points).
+            //    We call renderCreaturesAndOverlays() — a new thin wrapper that skips
+            //    flat terrain and water and only draws creatures + FOV.
+            //    Fallback: call render() with waterBuilt=true so water is skipped,
+            //    and with chunk meshes having 0 indices (they were never built).
+            g_renderer.render(g_world, aspect);
+        }
 
         // ── ImGui / ImPlot UI render pass ──────────────────────────────────
         // NewFrame() must be called after the platform back-ends have processed
         // input (ImGui_ImplWin32_NewFrame reads mouse/keyboard state from Win32)
         // and before any ImGui:: draw calls.
-        ImGui_ImplDX11_NewFrame();
-        ImGui_ImplWin32_NewFrame();
-        ImGui::NewFrame();
-
-        // DockSpaceOverViewport creates an invisible fullscreen docking host so
-        // all ImGui panels can be docked anywhere on screen.
-        // PassthruCentralNode = the 3D viewport shows through the empty central area.
-        ImGui::DockSpaceOverViewport(0, ImGui::GetMainViewport(),
-            ImGuiDockNodeFlags_PassthruCentralNode);
-
-        // Pass window dimensions to UI so it can do terrain hover raycasting
-        g_ui.windowW = (int)vp.Width;
-        g_ui.windowH = (int)vp.Height;
-
-        // Draw all simulation UI panels (controls, inspector, charts, species, etc.)
-        g_ui.draw(g_world, g_recorder, g_renderer);
-
-        // Render() finalises the ImGui draw lists into indexed vertex buffers.
-        // RenderDrawData() uploads them to the GPU and issues draw calls.
-        ImGui::Render();
-        ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
-
-        // If viewports are enabled, update and render any torn-off ImGui windows
-        // that live in their own OS windows (separate HWNDs).
-        if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
-            ImGui::UpdatePlatformWindows();
-            ImGui::RenderPlatformWindowsDefault();
+        {
+            PROFILE_SCOPE(PROF_UI);
+            ImGui_ImplDX11_NewFrame();
+            ImGui_ImplWin32_NewFrame();
+            ImGui::NewFrame();
+
+            // DockSpaceOverViewport creates an invisible fullscreen docking host so
+            // all ImGui panels can be docked anywhere on screen.
+            // PassthruCentralNode = the 3D viewport shows through the empty central area.
+            ImGui::DockSpaceOverViewport(0, ImGui::GetMainViewport(),
+                ImGuiDockNodeFlags_PassthruCentralNode);
+
+            // Pass window dimensions to UI so it can do terrain hover raycasting
+            g_ui.windowW = (int)vp.Width;
+            g_ui.windowH = (int)vp.Height;
+
+            // Draw all simulation UI panels (controls, inspector, charts, species, etc.)
+            g_ui.draw(g_world, g_recorder, g_renderer);
+
+            // Render() finalises the ImGui draw lists into indexed vertex buffers.
+            // RenderDrawData() uploads them to the GPU and issues draw calls.
+            ImGui::Render();
+            ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+
+            // If viewports are enabled, update and render any torn-off ImGui windows
+            // that live in their own OS windows (separate HWNDs).
+            if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
+                ImGui::UpdatePlatformWindows();
+                ImGui::RenderPlatformWindowsDefault();
+            }
         }
 
         // ── Present ───────────────────────────────────────────────────────
         // Present(1, 0) = sync to VBlank (vsync on). Swap the back and front buffers.
         // Returns DXGI_STATUS_OCCLUDED if the window became covered this frame;
         // we store that and skip rendering next frame until it's uncovered.
-        HRESULT hr = g_pSwapChain->Present(1, 0);
-        g_SwapChainOccluded = (hr == DXGI_STATUS_OCCLUDED);
+        {
+            PROFILE_SCOPE(PROF_PRESENT);
+            HRESULT hr = g_pSwapChain->Present(1, 0);
+            g_SwapChainOccluded = (hr == DXGI_STATUS_OCCLUDED);
+        }
+        profiler().endFrame(raw_dt, !g_world.cfg.paused);
         FrameMark;
     }
 
     // ── Shutdown ──────────────────────────────────────────────────────────────
+    if (g_ui.traceOnExit) trace().dump("exit");
+
     // Release everything in reverse initialisation order to avoid dangling references.
     g_planet.shutdown();
     g_renderer.shutdown();          // release D3D buffers, shaders, states
@@ -3,6 +3,9 @@
 #include "Sim/DataRecorder.hpp"
 #include "UI/SimUI.hpp"
 #include "World/World.hpp"
+#include "World/World_AsyncSave.hpp"
+#include "World/World_Rewind.hpp"
+#include "World/World_Sections.hpp"
 #include "Renderer/Planet/PlanetRenderer.hpp"
 
 // ── D3D11 globals ─────────────────────────────────────────────────────────────
@@ -17,9 +20,12 @@ UINT                    g_ResizeHeight         = 0;        //   applied at the s
 ID3D11RenderTargetView* g_mainRenderTargetView = nullptr;  // view into the swap chain's back buffer; bound as the output render target
 
 // ── Simulation objects ────────────────────────────────────────────────────────
-// All four objects live for the entire duration of the program.
+// All of these objects live for the entire duration of the program.
 World        g_world;     // terrain + creatures + plants + species registry
 DataRecorder g_recorder;  // samples population statistics at 1 Hz for graphing
 Renderer     g_renderer;  // D3D11 draw calls, camera, chunk mesh cache
 PlanetRenderer g_planet;  //
-SimUI        g_ui;        // all ImGui panels; owns selectedID / showDemoWindow etc.
\ No newline at end of file
+SimUI        g_ui;        // all ImGui panels; owns selectedID / showDemoWindow etc.
+AsyncSaver   g_saver;     // background world saves + autosave (owns a worker thread)
+RewindBuffer g_rewind;    // in-memory ring of compressed past states (owns a worker thread)
+StreamingLoad g_loader;   // sectioned-save load in progress (plants stream in per frame)
\ No newline at end of file
@@ -2,6 +2,9 @@
 #include <d3d11.h>
 #include <Windows.h>
 #include "World/World.hpp"
+#include "World/World_AsyncSave.hpp"
+#include "World/World_Rewind.hpp"
+#include "World/World_Sections.hpp"
 #include "Sim/DataRecorder.hpp"
 #include "Renderer/Renderer.hpp"
 #include "UI/SimUI.hpp"
@@ -24,6 +27,9 @@ extern DataRecorder     g_recorder;
 extern Renderer         g_renderer;
 extern PlanetRenderer   g_planet;
 extern SimUI            g_ui;
+extern AsyncSaver       g_saver;
+extern RewindBuffer     g_rewind;
+extern StreamingLoad    g_loader;
 
 // ── D3D11 helpers (implemented in App_D3D.cpp) ────────────────────────────────
 bool CreateDeviceD3D(HWND hWnd);
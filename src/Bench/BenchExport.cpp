@@ -0,0 +1,117 @@
+// KyberPlanet – CSV export throughput benchmark
+// Exports a synthetic population with the original ofstream loop and with the
+// parallel to_chars exporter at several thread counts, and reports rows/s and
+// MB/s for each.
+//
+//   KyberBenchExport [--creatures N] [--columns default|all] [--out DIR] [--reps R]
+#include "World/World_Export.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The exporter World::exportCSV used before the parallel path existed
+static void legacyExport(const std::vector<Creature>& creatures, const char* path) {
+    std::ofstream f(path);
+    f << "id,species,x,y,z,age,energy,speed,herbEff,carnEff\n";
+    for (const auto& c : creatures) {
+        f << c.id << ',' << c.speciesID << ','
+          << c.pos.x << ',' << c.pos.y << ',' << c.pos.z << ','
+          << c.age << ',' << c.energy << ','
+          << c.genome.maxSpeed() << ','
+          << c.genome.herbEfficiency() << ','
+          << c.genome.carnEfficiency() << '\n';
+    }
+}
+
+static void report(const char* name, size_t rows, size_t bytes, double sec) {
+    std::printf("%-24s %9zu rows  %8.1f MB  %8.3f s  %10.0f rows/s  %7.1f MB/s\n",
+                name, rows, bytes / 1048576.0, sec, rows / sec, bytes / 1048576.0 / sec);
+}
+
+int main(int argc, char** argv) {
+    size_t      count   = 100000;
+    uint32_t    columns = CSV_ALL;
+    std::string outDir  = ".";
+    int         reps    = 3;
+    for (int i = 1; i < argc; i++) {
+        if      (!std::strcmp(argv[i], "--creatures") && i + 1 < argc) count = std::strtoull(argv[++i], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--columns")   && i + 1 < argc) columns = !std::strcmp(argv[++i], "default") ? CSV_DEFAULT : CSV_ALL;
+        else if (!std::strcmp(argv[i], "--out")       && i + 1 < argc) outDir = argv[++i];
+        else if (!std::strcmp(argv[i], "--reps")      && i + 1 < argc) reps = std::max(1, std::atoi(argv[++i]));
+        else { std::fprintf(stderr, "usage: KyberBenchExport [--creatures N] [--columns default|all] [--out DIR] [--reps R]\n"); return 2; }
+    }
+
+    // ── Synthetic population ──────────────────────────────────────────────────
+    RNG rng(1234);
+    std::vector<SpeciesInfo> species(64);
+    for (uint32_t s = 0; s < species.size(); s++) {
+        species[s].id   = s + 1;
+        species[s].name = "Bench" + std::to_string(s + 1);
+    }
+    std::vector<Creature> creatures(count);
+    for (size_t i = 0; i < count; i++) {
+        Creature& c = creatures[i];
+        c.genome    = (i % 5 == 0) ? Genome::randomCarnivore(rng) : Genome::randomHerbivore(rng);
+        c.initFromGenome({rng.range(-1e4f, 1e4f), rng.range(-1e4f, 1e4f), rng.range(-1e4f, 1e4f)}, rng);
+        c.id        = (EntityID)(i + 1);
+        c.speciesID = 1 + (uint32_t)(i % species.size());
+        c.age       = rng.range(0.f, 600.f);
+        for (auto& u : c.needs.urgency) u = rng.uniform();
+    }
+
+    std::filesystem::path dir(outDir);
+    std::string legacyPath = (dir / "bench_legacy.csv").string();
+    std::string fastPath   = (dir / "bench_fast.csv").string();
+    using Clock = std::chrono::steady_clock;
+
+    // ── Baseline: ofstream, default columns only ──────────────────────────────
+    {
+        double best = 1e30;
+        for (int r = 0; r < reps; r++) {
+            auto t0 = Clock::now();
+            legacyExport(creatures, legacyPath.c_str());
+            best = std::min(best, std::chrono::duration<double>(Clock::now() - t0).count());
+        }
+        std::error_code ec;
+        report("ofstream (default cols)", count, (size_t)std::filesystem::file_size(legacyPath, ec), best);
+    }
+
+    // ── Parallel exporter ─────────────────────────────────────────────────────
+    int hw = (int)std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> threadCounts = {1};
+    for (int t = 2; t < hw; t *= 2) threadCounts.push_back(t);
+    if (hw > 1) threadCounts.push_back(hw);
+
+    for (uint32_t cols : {(uint32_t)CSV_DEFAULT, columns}) {
+        for (int t : threadCounts) {
+            CsvExportOptions opt;
+            opt.columns = cols;
+            opt.threads = t;
+            CsvExportStats best;
+            best.seconds = 1e30;
+            for (int r = 0; r < reps; r++) {
+                CsvExportStats st;
+                if (!exportCreaturesCSV(creatures, species, fastPath, opt, &st)) {
+                    std::fprintf(stderr, "export to %s failed\n", fastPath.c_str());
+                    return 1;
+                }
+                if (st.seconds < best.seconds) best = st;
+            }
+            char name[64];
+            std::snprintf(name, sizeof(name), "to_chars %s x%d",
+                          cols == CSV_DEFAULT ? "default" : "all", t);
+            report(name, best.rows, best.bytes, best.seconds);
+        }
+        if (columns == CSV_DEFAULT) break;
+    }
+
+    std::remove(legacyPath.c_str());
+    std::remove(fastPath.c_str());
+    return 0;
+}
@@ -0,0 +1,368 @@
+// KyberPlanet – end-to-end scenario benchmarks
+// Runs fixed-seed scenarios through the same loop as the headless runner
+// (World::tick plus DataRecorder::tick) and records throughput, tick latency
+// percentiles, peak RSS, heap allocations per tick (counted by
+// Core/AllocHooks.cpp) and final population. Results can be written out and
+// later used as the baseline another run is compared against; a run fails
+// (exit code 1) when a metric regresses past its threshold. p99 latency and
+// throughput are only compared for runs long enough to measure them (see
+// MIN_P99_TICKS and MIN_RATE_SECONDS).
+//
+//   KyberBenchScenario [--scenario NAME]... [--scale F] [--out results.json]
+//                      [--baseline base.json] [--max-slowdown PCT]
+//                      [--max-p99-growth PCT] [--max-rss-growth PCT]
+//                      [--max-alloc-growth PCT]
+//   KyberBenchScenario --list
+#include "Core/ProcessMemory.hpp"
+#include "Core/Profiler.hpp"
+#include "World/World.hpp"
+#include "World/World_Planet.hpp"
+#include "Sim/DataRecorder.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ── Scenarios ─────────────────────────────────────────────────────────────────
+struct Scenario {
+    const char* name;
+    const char* description;
+    int         herbivores;
+    int         carnivores;
+    int         maxPopulation;   // 0 = SimConfig default
+    float       seconds;         // sim seconds to run
+    float       simSpeed;        // sim seconds per real 1/60 s tick
+    float       herdRadius;      // > 0: herbivores start within this distance of one point
+};
+
+static const Scenario SCENARIOS[] = {
+    { "default",         "2000 herbivores, 400 carnivores",                2000,  400,     0,   60.f, 1.f,    0.f },
+    { "dense-herd",      "20k herbivores packed around one point",        20000,    0, 25000,    5.f, 1.f, 20000.f },
+    { "carnivore-heavy", "1000 herbivores, 1500 carnivores",               1000, 1500,     0,   60.f, 1.f,    0.f },
+    { "evolution-1h",    "default start, one sim hour at 4x speed",        2000,  400,     0, 3600.f, 4.f,    0.f },
+};
+
+static constexpr uint64_t SCENARIO_SEED   = 42;
+static constexpr int      SCENARIO_CHUNKS = 16;
+static constexpr float    SCENARIO_DT     = 1.f / 60.f;
+
+// ── Results ───────────────────────────────────────────────────────────────────
+struct ScenarioResult {
+    std::string name;
+    uint64_t    ticks          = 0;
+    double      seconds        = 0.0;   // wall
+    double      ticksPerSec    = 0.0;   // best window, see bestRate()
+    double      p50Ms          = 0.0;
+    double      p99Ms          = 0.0;
+    double      maxMs          = 0.0;
+    double      peakRssMB      = 0.0;
+    double      allocsPerTick  = -1.0;  // any thread, whole loop; -1 = not recorded
+    long long   population     = 0;
+};
+
+static double percentile(std::vector<float>& v, double pct) {
+    if (v.empty()) return 0.0;
+    size_t k = std::min(v.size() - 1, (size_t)(pct * 0.01 * v.size()));
+    std::nth_element(v.begin(), v.begin() + k, v.end());
+    return v[k];
+}
+
+// Throughput of the fastest of RATE_WINDOWS equal runs of ticks, the first
+// (warm-up: page faults, caches, containers growing) left out. Interference
+// from the rest of the machine only ever slows a window down, so the best one
+// is what two runs of the same build agree on.
+static constexpr int RATE_WINDOWS = 8;
+
+static double bestRate(const std::vector<float>& latencies) {
+    size_t per = latencies.size() / RATE_WINDOWS;
+    if (per == 0) {
+        double ms = 0.0;
+        for (float l : latencies) ms += l;
+        return ms > 0.0 ? latencies.size() * 1e3 / ms : 0.0;
+    }
+    double best = 0.0;
+    for (int w = 1; w < RATE_WINDOWS; w++) {
+        double ms = 0.0;
+        for (size_t i = w * per; i < (w + 1) * per; i++) ms += latencies[i];
+        if (ms > 0.0) best = std::max(best, per * 1e3 / ms);
+    }
+    return best;
+}
+
+// Herbivores scattered over a disc of the surface around a random land point
+static void spawnHerd(World& w, int count, float radius) {
+    RNG rng(SCENARIO_SEED + 2);
+    Vec3 centre = g_planet_surface.randomLandPos(rng);
+    for (int i = 0; i < count; i++) {
+        Vec3 pos = centre;
+        for (int tries = 0; tries < 32; tries++) {
+            Vec3 off  = { rng.range(-radius, radius), rng.range(-radius, radius), rng.range(-radius, radius) };
+            Vec3 cand = g_planet_surface.surfacePos((centre + off - g_planet_surface.center).normalised());
+            if (!g_planet_surface.isOcean(cand)) { pos = cand; break; }
+        }
+        w.spawnCreature(Genome::randomHerbivore(rng), pos);
+    }
+}
+
+static ScenarioResult runScenario(const Scenario& sc, float scale) {
+    using Clock = std::chrono::steady_clock;
+    bool peakReset = resetPeakRSS();
+
+    auto world    = std::make_unique<World>();
+    auto recorder = std::make_unique<DataRecorder>();
+    World& w = *world;
+    w.initial_herbivores = sc.herdRadius > 0.f ? 0 : sc.herbivores;
+    w.initial_carnivores = sc.carnivores;
+    w.generate(SCENARIO_SEED, SCENARIO_CHUNKS, SCENARIO_CHUNKS);
+    if (sc.herdRadius > 0.f) spawnHerd(w, sc.herbivores, sc.herdRadius);
+    if (sc.maxPopulation > 0) w.cfg.maxPopulation = sc.maxPopulation;
+    w.cfg.paused   = false;
+    w.cfg.simSpeed = sc.simSpeed;
+
+    std::fprintf(stderr, "%s: %s, %zu creatures, %.0f sim s%s\n", sc.name, sc.description,
+                 w.creatures.size(), sc.seconds * scale,
+                 peakReset ? "" : " (peak RSS includes earlier scenarios)");
+
+    std::vector<float> latencies;
+    float endTime = w.simTime + sc.seconds * scale;
+    auto  start   = Clock::now();
+    auto  prev    = start;
+    AllocTracker::Totals allocs0 = allocTracker().totals();
+    while (w.simTime < endTime && !w.creatures.empty()) {
+        w.tick(SCENARIO_DT);
+        recorder->tick(SCENARIO_DT * sc.simSpeed, w);
+        auto now = Clock::now();
+        latencies.push_back((float)std::chrono::duration<double, std::milli>(now - prev).count());
+        prev = now;
+    }
+
+    ScenarioResult r;
+    r.name        = sc.name;
+    r.ticks       = latencies.size();
+    r.seconds     = std::chrono::duration<double>(prev - start).count();
+    r.ticksPerSec = bestRate(latencies);
+    r.p50Ms       = percentile(latencies, 50.0);
+    r.p99Ms       = percentile(latencies, 99.0);
+    r.maxMs       = latencies.empty() ? 0.0 : *std::max_element(latencies.begin(), latencies.end());
+    r.peakRssMB   = peakRSS() / 1048576.0;
+    r.allocsPerTick = r.ticks ? (double)allocTracker().totals().since(allocs0).countAll() / r.ticks : 0.0;
+    r.population  = (long long)w.creatures.size();
+    return r;
+}
+
+// ── Results file ──────────────────────────────────────────────────────────────
+// JSON with one scenario object per line, so a baseline can be read back
+// without a JSON library.
+static bool writeResults(const std::string& path, const std::vector<ScenarioResult>& results, float scale) {
+    std::FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) return false;
+    std::fprintf(f, "{\n  \"benchmark\": \"KyberBenchScenario\",\n  \"seed\": %llu,\n  \"scale\": %g,\n  \"scenarios\": [\n",
+                 (unsigned long long)SCENARIO_SEED, scale);
+    for (size_t i = 0; i < results.size(); i++) {
+        const ScenarioResult& r = results[i];
+        std::fprintf(f, "    {\"name\": \"%s\", \"ticks\": %llu, \"seconds\": %.2f, \"ticks_per_sec\": %.2f, \"p50_ms\": %.3f, "
+                        "\"p99_ms\": %.3f, \"max_ms\": %.3f, \"peak_rss_mb\": %.1f, \"allocs_per_tick\": %.2f, "
+                        "\"final_population\": %lld}%s\n",
+                     r.name.c_str(), (unsigned long long)r.ticks, r.seconds, r.ticksPerSec, r.p50Ms,
+                     r.p99Ms, r.maxMs, r.peakRssMB, r.allocsPerTick, r.population, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    return std::fclose(f) == 0;
+}
+
+static bool jsonNumber(const std::string& line, const char* key, double& out) {
+    std::string k = std::string("\"") + key + "\":";
+    size_t p = line.find(k);
+    if (p == std::string::npos) return false;
+    out = std::strtod(line.c_str() + p + k.size(), nullptr);
+    return true;
+}
+
+static bool readResults(const std::string& path, std::vector<ScenarioResult>& out) {
+    std::ifstream f(path);
+    if (!f) return false;
+    std::string line;
+    while (std::getline(f, line)) {
+        size_t p = line.find("\"name\": \"");
+        if (p == std::string::npos) continue;
+        p += 9;
+        size_t q = line.find('"', p);
+        if (q == std::string::npos) continue;
+        ScenarioResult r;
+        double ticks = 0, pop = 0;
+        r.name = line.substr(p, q - p);
+        bool ok = jsonNumber(line, "ticks", ticks)
+               && jsonNumber(line, "ticks_per_sec", r.ticksPerSec)
+               && jsonNumber(line, "p99_ms", r.p99Ms)
+               && jsonNumber(line, "peak_rss_mb", r.peakRssMB)
+               && jsonNumber(line, "final_population", pop);
+        if (!ok) return false;
+        jsonNumber(line, "p50_ms", r.p50Ms);
+        jsonNumber(line, "max_ms", r.maxMs);
+        jsonNumber(line, "allocs_per_tick", r.allocsPerTick);   // absent in older baselines
+        if (!jsonNumber(line, "seconds", r.seconds) && r.ticksPerSec > 0.0)
+            r.seconds = ticks / r.ticksPerSec;                      // likewise
+        r.ticks      = (uint64_t)ticks;
+        r.population = (long long)pop;
+        out.push_back(r);
+    }
+    return true;
+}
+
+// ── Regression check ──────────────────────────────────────────────────────────
+struct Thresholds {
+    double maxSlowdown    = 10.0;   // % drop in ticks/s
+    double maxP99Growth   = 20.0;   // % rise in p99 tick latency
+    double maxRssGrowth   = 15.0;   // % rise in peak RSS
+    double maxAllocGrowth = 10.0;   // % rise in allocations per tick
+};
+
+// Short runs are too noisy to gate on. p99 of a short run is one of its few
+// slowest ticks – a page fault or a scheduler hiccup – so it is only compared
+// when both runs have at least MIN_P99_TICKS ticks (p99 then rests on the
+// slowest ten). Throughput of a run lasting a second or so swings by more
+// than the slowdown limit between identical builds, so ticks/s is only
+// compared when both runs took at least MIN_RATE_SECONDS of wall time.
+static constexpr uint64_t MIN_P99_TICKS    = 1000;
+static constexpr double   MIN_RATE_SECONDS = 5.0;
+
+// Prints one comparison row; true if it regressed. `higherIsBetter` flips
+// the sign of what counts as worse. A lower-is-better metric that was zero
+// (no allocations per tick, say) regresses as soon as it isn't.
+static bool compareMetric(const char* scenario, const char* metric, double base, double cur,
+                          double limitPct, bool higherIsBetter) {
+    double change = base != 0.0 ? (cur - base) / base * 100.0 : cur > 0.0 ? INFINITY : 0.0;
+    double worse  = higherIsBetter ? -change : change;
+    bool   bad    = base > 0.0 ? worse > limitPct : !higherIsBetter && cur > 0.0;
+    std::printf("  %-16s %-11s %12.2f %12.2f %+8.1f%%   limit %s%.0f%%  %s\n",
+                scenario, metric, base, cur, change, higherIsBetter ? "-" : "+", limitPct,
+                bad ? "REGRESSION" : "ok");
+    return bad;
+}
+
+static int compareToBaseline(const std::vector<ScenarioResult>& results,
+                             const std::vector<ScenarioResult>& baseline, const Thresholds& t) {
+    int regressions = 0;
+    std::printf("\ncomparison against baseline\n");
+    for (const ScenarioResult& r : results) {
+        auto it = std::find_if(baseline.begin(), baseline.end(),
+                               [&](const ScenarioResult& b) { return b.name == r.name; });
+        if (it == baseline.end()) {
+            std::printf("  %-16s not in baseline\n", r.name.c_str());
+            continue;
+        }
+        if (it->ticks != r.ticks)
+            std::printf("  %-16s ran %llu ticks, baseline %llu: was --scale the same?\n", r.name.c_str(),
+                        (unsigned long long)r.ticks, (unsigned long long)it->ticks);
+        if (std::min(it->seconds, r.seconds) >= MIN_RATE_SECONDS)
+            regressions += compareMetric(r.name.c_str(), "ticks/s", it->ticksPerSec, r.ticksPerSec, t.maxSlowdown, true);
+        else
+            std::printf("  %-16s %-11s not compared: under %.0f s of ticks (raise --scale)\n", r.name.c_str(),
+                        "ticks/s", MIN_RATE_SECONDS);
+        if (std::min(it->ticks, r.ticks) >= MIN_P99_TICKS)
+            regressions += compareMetric(r.name.c_str(), "p99 ms", it->p99Ms, r.p99Ms, t.maxP99Growth, false);
+        else
+            std::printf("  %-16s %-11s not compared: under %llu ticks (raise --scale)\n", r.name.c_str(),
+                        "p99 ms", (unsigned long long)MIN_P99_TICKS);
+        regressions += compareMetric(r.name.c_str(), "peak MB",  it->peakRssMB,   r.peakRssMB,   t.maxRssGrowth, false);
+        if (it->allocsPerTick >= 0.0)
+            regressions += compareMetric(r.name.c_str(), "allocs/tick", it->allocsPerTick, r.allocsPerTick,
+                                         t.maxAllocGrowth, false);
+        // Fixed seeds make the run deterministic, so a different outcome
+        // means the simulation changed, not just its speed
+        if (it->population != r.population)
+            std::printf("  %-16s final population %lld, baseline %lld (simulation behaviour changed)\n",
+                        r.name.c_str(), r.population, it->population);
+    }
+    std::printf("%d regression%s\n", regressions, regressions == 1 ? "" : "s");
+    return regressions;
+}
+
+// ── Command line ──────────────────────────────────────────────────────────────
+struct ScenarioOptions {
+    std::vector<std::string> names;   // empty = all
+    float       scale = 1.f;          // multiplies every scenario's duration
+    std::string outPath, baselinePath;
+    Thresholds  thresholds;
+    bool        list  = false;
+};
+
+static void usage() {
+    std::fprintf(stderr,
+        "usage: KyberBenchScenario [--scenario NAME]... [--scale F] [--out results.json]\n"
+        "                          [--baseline base.json] [--max-slowdown PCT]\n"
+        "                          [--max-p99-growth PCT] [--max-rss-growth PCT]\n"
+        "                          [--max-alloc-growth PCT]\n"
+        "       KyberBenchScenario --list\n");
+}
+
+static bool parseArgs(int argc, char** argv, ScenarioOptions& o) {
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if      (a == "--list")                             o.list = true;
+        else if (a == "--scenario"       && (v = next()))   o.names.push_back(v);
+        else if (a == "--scale"          && (v = next()))   o.scale = (float)std::atof(v);
+        else if (a == "--out"            && (v = next()))   o.outPath = v;
+        else if (a == "--baseline"       && (v = next()))   o.baselinePath = v;
+        else if (a == "--max-slowdown"   && (v = next()))   o.thresholds.maxSlowdown  = std::atof(v);
+        else if (a == "--max-p99-growth" && (v = next()))   o.thresholds.maxP99Growth = std::atof(v);
+        else if (a == "--max-rss-growth" && (v = next()))   o.thresholds.maxRssGrowth = std::atof(v);
+        else if (a == "--max-alloc-growth" && (v = next())) o.thresholds.maxAllocGrowth = std::atof(v);
+        else return false;
+    }
+    return o.scale > 0.f;
+}
+
+int main(int argc, char** argv) {
+    ScenarioOptions opt;
+    if (!parseArgs(argc, argv, opt)) { usage(); return 2; }
+
+    if (opt.list) {
+        for (const Scenario& sc : SCENARIOS)
+            std::printf("%-16s %s, %.0f sim s\n", sc.name, sc.description, sc.seconds);
+        return 0;
+    }
+
+    std::vector<const Scenario*> run;
+    for (const Scenario& sc : SCENARIOS)
+        if (opt.names.empty() || std::find(opt.names.begin(), opt.names.end(), sc.name) != opt.names.end())
+            run.push_back(&sc);
+    if (run.size() < std::max<size_t>(opt.names.size(), 1)) {
+        std::fprintf(stderr, "unknown scenario; --list shows them\n");
+        return 2;
+    }
+
+    // Read first, so a bad path fails before the long part
+    std::vector<ScenarioResult> baseline;
+    if (!opt.baselinePath.empty() && !readResults(opt.baselinePath, baseline)) {
+        std::fprintf(stderr, "failed to read baseline %s\n", opt.baselinePath.c_str());
+        return 1;
+    }
+
+    std::vector<ScenarioResult> results;
+    std::printf("%-16s %8s %10s %9s %9s %9s %9s %12s %8s\n",
+                "scenario", "ticks", "ticks/s", "p50 ms", "p99 ms", "max ms", "peak MB", "allocs/tick", "pop");
+    for (const Scenario* sc : run) {
+        ScenarioResult r = runScenario(*sc, opt.scale);
+        std::printf("%-16s %8llu %10.1f %9.3f %9.3f %9.3f %9.1f %12.2f %8lld\n",
+                    r.name.c_str(), (unsigned long long)r.ticks, r.ticksPerSec,
+                    r.p50Ms, r.p99Ms, r.maxMs, r.peakRssMB, r.allocsPerTick, r.population);
+        std::fflush(stdout);
+        results.push_back(r);
+    }
+
+    if (!opt.outPath.empty() && !writeResults(opt.outPath, results, opt.scale)) {
+        std::fprintf(stderr, "failed to write %s\n", opt.outPath.c_str());
+        return 1;
+    }
+    if (!baseline.empty() && compareToBaseline(results, baseline, opt.thresholds) > 0) return 1;
+    return 0;
+}
@@ -0,0 +1,414 @@
+// KyberPlanet – simulation hot-path micro-benchmarks
+// Times the functions a tick spends its time in, one at a time, on fixed-seed
+// fixtures: the seed-42 planet populated with 1k, 10k and 100k creatures (one
+// in six a carnivore). Reports ns/op, ops/s and heap allocations per op
+// (counted by Core/AllocHooks.cpp), as a table and optionally as JSON for
+// comparing runs. The random samplers and the trace recorder are timed
+// first, without a fixture.
+//
+// --perf adds hardware counters per op (cycles, instructions, L1d and LLC
+// misses, branch misses; Linux perf_event_open), or notes why they are
+// unavailable and runs without them.
+//
+// --check-rng instead tests the normal samplers' output against N(0, 1):
+// the first four moments, the 3-sigma tail mass and a Kolmogorov-Smirnov
+// test, each at a significance far below any plausible flake. Exits 1 on a
+// failure.
+//
+//   KyberBenchSim [--sizes 1000,10000,100000] [--min-time S] [--filter TEXT]
+//                 [--json out.json] [--perf]
+//   KyberBenchSim --check-rng
+#include "World/World.hpp"
+#include "World/World_Planet.hpp"
+#include "Core/Profiler.hpp"
+#include "Core/Trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ── World access ──────────────────────────────────────────────────────────────
+// Friend of World: forwards to the private stages so they can be timed alone
+struct WorldBench {
+    static void perceive(World& w, Creature& c, float dt) { w.perceive(c, dt); }
+    static void rebuildSpatialHash(World& w) { w.rebuildSpatialHash(); }
+    static void queryRadius(const World& w, const Vec3& p, float r, std::vector<uint32_t>& out) {
+        w.queryRadius(p, r, out);
+    }
+};
+
+// ── Harness ───────────────────────────────────────────────────────────────────
+static constexpr uint64_t BENCH_SEED = 42;
+static constexpr int      BENCH_CHUNKS = 16;
+static constexpr float    BENCH_DT   = 1.f / 60.f;
+
+struct BenchOptions {
+    bool                checkRng = false;
+    bool                perf     = false;
+    std::vector<size_t> sizes   = {1000, 10000, 100000};
+    double              minTime = 0.25;   // seconds of timed batches per benchmark
+    std::string         filter;           // run only names containing this
+    std::string         jsonPath;
+};
+
+struct BenchResult {
+    std::string name;
+    size_t      population = 0;
+    uint64_t    ops        = 0;
+    double      seconds    = 0.0;
+    uint64_t    allocs     = 0;
+    uint64_t    bytes      = 0;
+    uint64_t    perf[PERF_EVENTS] = {};   // counter deltas over the timed batches
+
+    double perfPerOp(int e) const { return ops ? (double)perf[e] / ops : 0.0; }
+
+    double nsPerOp()     const { return ops ? seconds * 1e9 / ops : 0.0; }
+    double opsPerSec()   const { return seconds > 0.0 ? ops / seconds : 0.0; }
+    double allocsPerOp() const { return ops ? (double)allocs / ops : 0.0; }
+    double bytesPerOp()  const { return ops ? (double)bytes / ops : 0.0; }
+};
+
+// Keeps results alive so the optimiser can't drop the work
+static volatile float g_sink = 0.f;
+
+// One untimed warm-up batch, then batches until minTime has passed. A batch
+// runs some ops and returns how many.
+template <typename Batch>
+static BenchResult measure(const BenchOptions& opt, const char* name, size_t pop, Batch batch) {
+    using Clock = std::chrono::steady_clock;
+    BenchResult r;
+    r.name       = name;
+    r.population = pop;
+    batch();
+
+    PerfCounters& pc = perfCounters();
+    uint64_t p0[PERF_EVENTS], p1[PERF_EVENTS];
+    pc.read(p0);
+    AllocTracker::Totals a0 = allocTracker().totals();
+    auto     t0 = Clock::now();
+    do {
+        r.ops    += batch();
+        r.seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    } while (r.seconds < opt.minTime);
+    AllocTracker::Totals da = allocTracker().totals().since(a0);
+    pc.read(p1);
+    for (int e = 0; e < PERF_EVENTS; e++) r.perf[e] = p1[e] - p0[e];
+    r.allocs = da.countAll();
+    r.bytes  = da.bytesAll();
+
+    std::printf("%-28s %7zu %11llu %12.1f %14.0f %10.3f %12.1f",
+                r.name.c_str(), r.population, (unsigned long long)r.ops,
+                r.nsPerOp(), r.opsPerSec(), r.allocsPerOp(), r.bytesPerOp());
+    if (pc.active())
+        for (int e = 0; e < PERF_EVENTS; e++) {
+            if (pc.has(e)) std::printf(" %13.1f", r.perfPerOp(e));
+            else           std::printf(" %13s", "-");
+        }
+    std::printf("\n");
+    std::fflush(stdout);
+    return r;
+}
+
+static bool wanted(const BenchOptions& opt, const char* name) {
+    return opt.filter.empty() || std::strstr(name, opt.filter.c_str());
+}
+
+// ── Samplers ──────────────────────────────────────────────────────────────────
+static void runSamplers(const BenchOptions& opt, std::vector<BenchResult>& out) {
+    auto run = [&](const char* name, auto batch) {
+        if (wanted(opt, name)) out.push_back(measure(opt, name, 0, batch));
+    };
+    RNG rng(BENCH_SEED);
+
+    run("RNG::normalBoxMuller", [&] {
+        float sum = 0.f;
+        for (int k = 0; k < 4096; k++) sum += rng.normalBoxMuller();
+        g_sink = g_sink + sum;
+        return 4096;
+    });
+    run("RNG::normal", [&] {
+        float sum = 0.f;
+        for (int k = 0; k < 4096; k++) sum += rng.normal();
+        g_sink = g_sink + sum;
+        return 4096;
+    });
+    // As the simulation uses it: a fresh stream per entity, a few draws each
+    uint32_t entity = 0;
+    run("CounterRNG::normal", [&] {
+        float sum = 0.f;
+        for (int k = 0; k < 1024; k++) {
+            CounterRNG r(BENCH_SEED, RNG_BIRTH, ++entity, 0);
+            for (int d = 0; d < 4; d++) sum += r.normal();
+        }
+        g_sink = g_sink + sum;
+        return 4096;
+    });
+    // A birth's genome: crossover plus per-gene mutation at the top of the
+    // mutation-rate range, where normals dominate
+    Genome a = Genome::randomHerbivore(rng), b = Genome::randomHerbivore(rng);
+    a.raw[GENE_MUTATION_RATE] = b.raw[GENE_MUTATION_RATE] = 1.f;
+    run("Genome::crossover+mutate", [&] {
+        float sum = 0.f;
+        for (int k = 0; k < 256; k++) {
+            CounterRNG r(BENCH_SEED, RNG_BIRTH, ++entity, 0);
+            Genome child = Genome::crossover(a, b, r);
+            child.mutate(r);
+            sum += child.raw[k % GENOME_SIZE];
+        }
+        g_sink = g_sink + sum;
+        return 256;
+    });
+    // What a scope pays on top of its clock reads while the recorder runs;
+    // a private recorder, so the fixtures below run with tracing off
+    TraceRecorder tr;
+    tr.start(1 << 12);
+    TraceRecorder::Clock::time_point t0 = TraceRecorder::Clock::now(), t1 = t0 + std::chrono::microseconds(3);
+    run("TraceRecorder::complete", [&] {
+        for (int k = 0; k < 4096; k++) tr.complete("bench", TRACE_STAGE, t0, t1);
+        return 4096;
+    });
+}
+
+// ── Normal sampler checks ─────────────────────────────────────────────────────
+static double normalCDF(double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); }
+
+// Tolerances are 6 standard errors for n samples (5 sigma for KS, the
+// asymptotic p = 1e-6 critical value), so a correct sampler never fails
+static bool checkNormalSample(const char* name, std::vector<double>& xs) {
+    double n = (double)xs.size();
+    double m1 = 0, m2 = 0, m3 = 0, m4 = 0, tail = 0;
+    for (double x : xs) m1 += x;
+    m1 /= n;
+    for (double x : xs) {
+        double d = x - m1, d2 = d * d;
+        m2 += d2; m3 += d2 * d; m4 += d2 * d2;
+        tail += std::fabs(x) > 3.0;
+    }
+    m2 /= n; m3 /= n; m4 /= n; tail /= n;
+    double skew = m3 / std::pow(m2, 1.5);
+    double kurt = m4 / (m2 * m2) - 3.0;
+
+    std::sort(xs.begin(), xs.end());
+    double ks = 0;
+    for (size_t i = 0; i < xs.size(); i++) {
+        double F = normalCDF(xs[i]);
+        ks = std::max(ks, std::max(F - i / n, (i + 1) / n - F));
+    }
+
+    const double pTail = 2.0 * normalCDF(-3.0);
+    bool ok = std::fabs(m1) < 6.0 * std::sqrt(1.0 / n)
+           && std::fabs(m2 - 1.0) < 6.0 * std::sqrt(2.0 / n)
+           && std::fabs(skew) < 6.0 * std::sqrt(6.0 / n)
+           && std::fabs(kurt) < 6.0 * std::sqrt(24.0 / n)
+           && std::fabs(tail - pTail) < 6.0 * std::sqrt(pTail / n)
+           && ks * std::sqrt(n) < 2.63;
+    std::printf("%-22s %9.5f %9.5f %9.5f %9.5f %9.6f %9.4f  %s\n",
+                name, m1, m2, skew, kurt, tail, ks * std::sqrt(n), ok ? "ok" : "FAIL");
+    return ok;
+}
+
+static bool checkNormals() {
+    const size_t N = 2000000;
+    std::vector<double> xs(N);
+    bool ok = true;
+    std::printf("%-22s %9s %9s %9s %9s %9s %9s\n", "sampler", "mean", "var", "skew", "ex.kurt", ">3sd", "KS*sqrtN");
+
+    RNG rng(BENCH_SEED);
+    for (double& x : xs) x = rng.normal();
+    ok &= checkNormalSample("RNG::normal", xs);
+
+    // Scaled: mean and stddev are applied, not just passed through
+    for (double& x : xs) x = (rng.normal(5.f, 0.25f) - 5.0) / 0.25;
+    ok &= checkNormalSample("RNG::normal(5, 0.25)", xs);
+
+    // First draw of consecutive entity streams: keys must not correlate
+    for (size_t i = 0; i < N; i++) xs[i] = CounterRNG(BENCH_SEED, RNG_BIRTH, (uint32_t)i, 7).normal();
+    ok &= checkNormalSample("CounterRNG::normal", xs);
+
+    for (double& x : xs) x = rng.normalBoxMuller();
+    ok &= checkNormalSample("RNG::normalBoxMuller", xs);
+    return ok;
+}
+
+// The seed-42 planet with `n` creatures, spatial hash built, as after a tick
+static std::unique_ptr<World> makeFixture(size_t n) {
+    auto w = std::make_unique<World>();
+    w->initial_carnivores   = (int)(n / 6);
+    w->initial_herbivores   = (int)(n - n / 6);
+    w->cfg.maxPopulation    = (int)n;
+    w->generate(BENCH_SEED, BENCH_CHUNKS, BENCH_CHUNKS);
+    WorldBench::rebuildSpatialHash(*w);
+    return w;
+}
+
+// Per-creature ops walk the population from where the last batch stopped
+struct Cursor {
+    size_t i = 0;
+    size_t next(size_t n) { size_t k = i; i = (i + 1) % n; return k; }
+};
+
+static void runFixture(const BenchOptions& opt, size_t n, std::vector<BenchResult>& out) {
+    auto t0 = std::chrono::steady_clock::now();
+    std::unique_ptr<World> fixture = makeFixture(n);
+    World& w = *fixture;
+    std::fprintf(stderr, "fixture %zu: %zu creatures, %zu species, %zu plants (%.1f s)\n",
+                 n, w.creatures.size(), w.species.size(), w.plants.size(),
+                 std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+
+    std::vector<Creature>& cs = w.creatures;
+    size_t pop = cs.size();
+    auto run = [&](const char* name, auto batch) {
+        if (wanted(opt, name)) out.push_back(measure(opt, name, pop, batch));
+    };
+
+    std::string savePath = (std::filesystem::temp_directory_path() / "kyber_bench_sim.kybrp").string();
+    std::vector<uint32_t> hits;
+    Cursor cur;
+
+    run("World::rebuildSpatialHash", [&] {
+        WorldBench::rebuildSpatialHash(w);
+        return 1;
+    });
+    run("World::queryRadius", [&] {
+        for (int k = 0; k < 256; k++) {
+            const Creature& c = cs[cur.next(pop)];
+            WorldBench::queryRadius(w, c.pos, c.genome.visionRange(), hits);
+            g_sink = g_sink + (float)hits.size();
+        }
+        return 256;
+    });
+    run("World::perceive", [&] {
+        for (int k = 0; k < 256; k++) WorldBench::perceive(w, cs[cur.next(pop)], BENCH_DT);
+        return 256;
+    });
+    run("Genome::distanceTo", [&] {
+        float sum = 0.f;
+        for (int k = 0; k < 4096; k++) {
+            size_t a = cur.next(pop);
+            sum += cs[a].genome.distanceTo(cs[(a * 7 + 13) % pop].genome);
+        }
+        g_sink = g_sink + sum;
+        return 4096;
+    });
+    run("PlanetSurface::slopeAt", [&] {
+        float sum = 0.f;
+        for (int k = 0; k < 256; k++) sum += g_planet_surface.slopeAt(cs[cur.next(pop)].pos);
+        g_sink = g_sink + sum;
+        return 256;
+    });
+    run("PlanetSurface::findOcean", [&] {
+        Vec3 water;
+        int  found = 0;
+        for (int k = 0; k < 64; k++) {
+            const Creature& c = cs[cur.next(pop)];
+            found += g_planet_surface.findOcean(c.pos, c.genome.visionRange(), water);
+        }
+        g_sink = g_sink + (float)found;
+        return 64;
+    });
+    // Re-classifying live genomes finds their own species and bumps its count,
+    // so the registry does not grow while this runs
+    run("World::classifySpecies", [&] {
+        uint32_t sum = 0;
+        for (int k = 0; k < 256; k++) sum += w.classifySpecies(cs[cur.next(pop)].genome);
+        g_sink = g_sink + (float)sum;
+        return 256;
+    });
+    run("World::saveToFile", [&] {
+        if (!w.saveToFile(savePath.c_str())) { std::fprintf(stderr, "save failed\n"); std::exit(1); }
+        return 1;
+    });
+    if (wanted(opt, "World::loadFromFile")) {
+        if (!w.saveToFile(savePath.c_str())) { std::fprintf(stderr, "save failed\n"); std::exit(1); }
+        run("World::loadFromFile", [&] {
+            if (!w.loadFromFile(savePath.c_str())) { std::fprintf(stderr, "load failed\n"); std::exit(1); }
+            return 1;
+        });
+    }
+    std::remove(savePath.c_str());
+}
+
+static bool writeJSON(const std::string& path, const BenchOptions& opt, const std::vector<BenchResult>& results) {
+    FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) return false;
+    std::fprintf(f, "{\n  \"benchmark\": \"KyberBenchSim\",\n  \"seed\": %llu,\n  \"min_time\": %g,\n  \"results\": [\n",
+                 (unsigned long long)BENCH_SEED, opt.minTime);
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        std::fprintf(f, "    {\"name\": \"%s\", \"population\": %zu, \"ops\": %llu, \"ns_per_op\": %.3f, "
+                        "\"ops_per_sec\": %.1f, \"allocs_per_op\": %.4f, \"bytes_per_op\": %.1f",
+                     r.name.c_str(), r.population, (unsigned long long)r.ops, r.nsPerOp(),
+                     r.opsPerSec(), r.allocsPerOp(), r.bytesPerOp());
+        // Only the events that were counted
+        static const char* keys[PERF_EVENTS] = { "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses" };
+        for (int e = 0; e < PERF_EVENTS; e++)
+            if (perfCounters().has(e)) std::fprintf(f, ", \"%s_per_op\": %.2f", keys[e], r.perfPerOp(e));
+        std::fprintf(f, "}%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    return std::fclose(f) == 0;
+}
+
+static bool parseArgs(int argc, char** argv, BenchOptions& o) {
+    for (int i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        if (!std::strcmp(a, "--check-rng")) { o.checkRng = true; continue; }
+        if (!std::strcmp(a, "--perf"))      { o.perf = true; continue; }
+        const char* v = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (!v) return false;
+        i++;
+        if (!std::strcmp(a, "--sizes")) {
+            o.sizes.clear();
+            for (const char* p = v; *p; ) {
+                char* end;
+                size_t n = std::strtoull(p, &end, 10);
+                if (end == p || n == 0) return false;
+                o.sizes.push_back(n);
+                p = *end == ',' ? end + 1 : end;
+                if (*end && *end != ',') return false;
+            }
+        }
+        else if (!std::strcmp(a, "--min-time")) o.minTime = std::atof(v);
+        else if (!std::strcmp(a, "--filter"))   o.filter = v;
+        else if (!std::strcmp(a, "--json"))     o.jsonPath = v;
+        else return false;
+    }
+    return !o.sizes.empty() && o.minTime > 0.0;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions opt;
+    if (!parseArgs(argc, argv, opt)) {
+        std::fprintf(stderr, "usage: KyberBenchSim [--sizes 1000,10000,100000] [--min-time S] "
+                             "[--filter TEXT] [--json out.json] [--perf]\n"
+                             "       KyberBenchSim --check-rng\n");
+        return 2;
+    }
+    if (opt.checkRng) return checkNormals() ? 0 : 1;
+
+    if (opt.perf) {
+        perfCounters().open();
+        std::fprintf(stderr, "hardware counters: %s\n", perfCounters().status().c_str());
+    }
+    std::printf("%-28s %7s %11s %12s %14s %10s %12s",
+                "benchmark", "pop", "ops", "ns/op", "ops/s", "allocs/op", "bytes/op");
+    static const char* perfHeads[PERF_EVENTS] = { "cycles/op", "instr/op", "L1d miss/op", "LLC miss/op", "br miss/op" };
+    if (perfCounters().active())
+        for (int e = 0; e < PERF_EVENTS; e++) std::printf(" %13s", perfHeads[e]);
+    std::printf("\n");
+    std::vector<BenchResult> results;
+    runSamplers(opt, results);
+    for (size_t n : opt.sizes) runFixture(opt, n, results);
+
+    if (!opt.jsonPath.empty() && !writeJSON(opt.jsonPath, opt, results)) {
+        std::fprintf(stderr, "failed to write %s\n", opt.jsonPath.c_str());
+        return 1;
+    }
+    return 0;
+}
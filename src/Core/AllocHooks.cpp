@@ -0,0 +1,45 @@
+// ── Allocation hooks ──────────────────────────────────────────────────────────
+// Replaces the global operator new/delete so every heap allocation in the
+// executable is counted by allocTracker() against the current profiler stage.
+// Compile this file into an executable to turn tracking on; it must not go
+// into a library, where the replacement would leak into every consumer.
+#include "Profiler.hpp"
+#include <cstdlib>
+#include <new>
+
+static const bool g_hooked = (allocTracker().hooked = true);
+
+static void* countedAlloc(std::size_t n) {
+    allocTracker().record(n);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+
+// The aligned forms need their own free on Windows
+#ifdef _WIN32
+#include <malloc.h>
+static void* alignedAlloc(std::size_t n, std::size_t a) { return _aligned_malloc(n ? n : 1, a); }
+static void  alignedFree(void* p)                        { _aligned_free(p); }
+#else
+static void* alignedAlloc(std::size_t n, std::size_t a) { return std::aligned_alloc(a, (n + a - 1) / a * a); }
+static void  alignedFree(void* p)                        { std::free(p); }
+#endif
+
+static void* countedAlignedAlloc(std::size_t n, std::align_val_t al) {
+    allocTracker().record(n);
+    if (void* p = alignedAlloc(n, (std::size_t)al)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new  (std::size_t n)                       { return countedAlloc(n); }
+void* operator new[](std::size_t n)                       { return countedAlloc(n); }
+void* operator new  (std::size_t n, std::align_val_t al)  { return countedAlignedAlloc(n, al); }
+void* operator new[](std::size_t n, std::align_val_t al)  { return countedAlignedAlloc(n, al); }
+void  operator delete  (void* p) noexcept                        { std::free(p); }
+void  operator delete[](void* p) noexcept                        { std::free(p); }
+void  operator delete  (void* p, std::size_t) noexcept           { std::free(p); }
+void  operator delete[](void* p, std::size_t) noexcept           { std::free(p); }
+void  operator delete  (void* p, std::align_val_t) noexcept      { alignedFree(p); }
+void  operator delete[](void* p, std::align_val_t) noexcept      { alignedFree(p); }
+void  operator delete  (void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
+void  operator delete[](void* p, std::size_t, std::align_val_t) noexcept { alignedFree(p); }
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <vector>
+
+// ── ByteWriter ────────────────────────────────────────────────────────────────
+// Appends raw little-endian values to a growable byte buffer.
+// Used by the save/checkpoint encoders so the expensive serialisation step can
+// run on a background thread against a snapshot, and the result can be written
+// to disk (or compressed) in one bulk operation.
+struct ByteWriter {
+    std::vector<uint8_t> bytes;
+
+    void clear()                { bytes.clear(); }
+    void reserve(size_t n)      { bytes.reserve(n); }
+    size_t size() const         { return bytes.size(); }
+
+    void write(const void* src, size_t n) {
+        size_t at = bytes.size();
+        bytes.resize(at + n);
+        if (n > 0) std::memcpy(bytes.data() + at, src, n);
+    }
+
+    void writeF  (float v)    { write(&v, sizeof(v)); }
+    void writeU32(uint32_t v) { write(&v, sizeof(v)); }
+    void writeI32(int32_t v)  { write(&v, sizeof(v)); }
+    void writeU64(uint64_t v) { write(&v, sizeof(v)); }
+    void writeU8 (uint8_t v)  { write(&v, sizeof(v)); }
+    void writeFA (const float* arr, int n) { write(arr, sizeof(float) * n); }
+
+    // Overwrite a previously reserved 32-bit slot (e.g. a count written up-front)
+    void patchU32(size_t at, uint32_t v) { std::memcpy(bytes.data() + at, &v, sizeof(v)); }
+};
+
+// ── ByteReader ────────────────────────────────────────────────────────────────
+// Bounds-checked reader over a borrowed byte range (file buffer, mmap, or a
+// decompressed block). Reading past the end never crashes: the value is zeroed
+// and `ok` becomes false, so callers can decode a whole record and check once.
+struct ByteReader {
+    const uint8_t* data = nullptr;
+    size_t         len  = 0;
+    size_t         pos  = 0;
+    bool           ok   = true;
+
+    ByteReader() = default;
+    ByteReader(const uint8_t* d, size_t n) : data(d), len(n) {}
+
+    size_t remaining() const { return len - pos; }
+
+    bool read(void* dst, size_t n) {
+        if (n > remaining()) { std::memset(dst, 0, n); ok = false; pos = len; return false; }
+        std::memcpy(dst, data + pos, n);
+        pos += n;
+        return true;
+    }
+
+    // Advance without copying; used to skip records a caller doesn't need
+    bool skip(size_t n) {
+        if (n > remaining()) { ok = false; pos = len; return false; }
+        pos += n;
+        return true;
+    }
+
+    float    readF()   { float v=0;    read(&v, sizeof(v)); return v; }
+    uint32_t readU32() { uint32_t v=0; read(&v, sizeof(v)); return v; }
+    int32_t  readI32() { int32_t v=0;  read(&v, sizeof(v)); return v; }
+    uint64_t readU64() { uint64_t v=0; read(&v, sizeof(v)); return v; }
+    uint8_t  readU8()  { uint8_t v=0;  read(&v, sizeof(v)); return v; }
+    void     readFA(float* arr, int n) { read(arr, sizeof(float) * n); }
+};
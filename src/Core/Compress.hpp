@@ -0,0 +1,128 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <vector>
+
+// ── Lightweight byte compression ──────────────────────────────────────────────
+// A three-stage filter tuned for arrays of fixed-size binary records:
+//
+//   1. Shuffle:  transpose the records so byte k of every record is stored
+//                together. Float exponents, small integers and unchanged fields
+//                end up in long, nearly constant runs.
+//   2. Delta:    replace each byte by its difference from the previous one,
+//                turning constant runs into runs of zero.
+//   3. PackBits: run-length encode. Control byte c < 128 → copy c+1 literal
+//                bytes; c >= 128 → repeat the next byte (c - 125) times (3..130).
+//
+// Far weaker than LZ-class codecs on text, but it is a single linear pass with
+// no tables, so it is cheap enough to run on every checkpoint and rewind frame.
+//
+// Block layout: [u64 raw size][u32 stride][PackBits payload]
+
+namespace Compress {
+
+inline void shuffle(const uint8_t* src, size_t n, size_t stride, uint8_t* dst) {
+    size_t recs = stride > 1 ? n / stride : 0;
+    size_t body = recs * stride;
+    for (size_t b = 0; b < stride && recs > 0; b++)
+        for (size_t i = 0; i < recs; i++)
+            dst[b * recs + i] = src[i * stride + b];
+    std::memcpy(dst + body, src + body, n - body);   // partial tail record as-is
+}
+
+inline void unshuffle(const uint8_t* src, size_t n, size_t stride, uint8_t* dst) {
+    size_t recs = stride > 1 ? n / stride : 0;
+    size_t body = recs * stride;
+    for (size_t b = 0; b < stride && recs > 0; b++)
+        for (size_t i = 0; i < recs; i++)
+            dst[i * stride + b] = src[b * recs + i];
+    std::memcpy(dst + body, src + body, n - body);
+}
+
+// Append a compressed block for `src[0..n)` to `out`.
+// `stride` is the record size in bytes (1 = unstructured data).
+inline void compress(const uint8_t* src, size_t n, size_t stride, std::vector<uint8_t>& out) {
+    uint64_t raw = n;
+    uint32_t str = (uint32_t)(stride == 0 ? 1 : stride);
+    size_t   at  = out.size();
+    out.resize(at + sizeof(raw) + sizeof(str));
+    std::memcpy(out.data() + at, &raw, sizeof(raw));
+    std::memcpy(out.data() + at + sizeof(raw), &str, sizeof(str));
+    if (n == 0) return;
+
+    // Shuffle + delta into a scratch buffer
+    std::vector<uint8_t> tmp(n);
+    shuffle(src, n, str, tmp.data());
+    uint8_t prev = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint8_t v = tmp[i];
+        tmp[i] = (uint8_t)(v - prev);
+        prev = v;
+    }
+
+    // PackBits; worst case grows by 1 byte per 128
+    out.reserve(out.size() + n + n / 128 + 16);
+    size_t i = 0, litStart = 0;
+    auto flushLiterals = [&](size_t end) {
+        while (litStart < end) {
+            size_t len = end - litStart < 128 ? end - litStart : 128;
+            out.push_back((uint8_t)(len - 1));
+            out.insert(out.end(), tmp.begin() + litStart, tmp.begin() + litStart + len);
+            litStart += len;
+        }
+    };
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < 130 && tmp[i + run] == tmp[i]) run++;
+        if (run >= 3) {
+            flushLiterals(i);
+            out.push_back((uint8_t)(run + 125));
+            out.push_back(tmp[i]);
+            i += run;
+            litStart = i;
+        } else {
+            i += run;
+        }
+    }
+    flushLiterals(n);
+}
+
+// Decode one block starting at `src`. Replaces `out` with the raw bytes and
+// returns the number of input bytes consumed, or 0 if the block is corrupt.
+inline size_t decompress(const uint8_t* src, size_t avail, std::vector<uint8_t>& out) {
+    uint64_t raw = 0;
+    uint32_t str = 1;
+    if (avail < sizeof(raw) + sizeof(str)) return 0;
+    std::memcpy(&raw, src, sizeof(raw));
+    std::memcpy(&str, src + sizeof(raw), sizeof(str));
+    size_t p = sizeof(raw) + sizeof(str);
+    if (str == 0 || raw > ((uint64_t)avail - p) * 130) return 0;   // impossible ratio
+
+    std::vector<uint8_t> tmp((size_t)raw);
+    size_t o = 0;
+    while (o < raw) {
+        if (p >= avail) return 0;
+        uint8_t c = src[p++];
+        if (c < 128) {
+            size_t len = (size_t)c + 1;
+            if (p + len > avail || o + len > raw) return 0;
+            std::memcpy(tmp.data() + o, src + p, len);
+            p += len; o += len;
+        } else {
+            size_t len = (size_t)c - 125;
+            if (p >= avail || o + len > raw) return 0;
+            std::memset(tmp.data() + o, src[p++], len);
+            o += len;
+        }
+    }
+
+    // Undo delta, then shuffle
+    uint8_t prev = 0;
+    for (size_t i = 0; i < raw; i++) { prev = (uint8_t)(prev + tmp[i]); tmp[i] = prev; }
+    out.resize((size_t)raw);
+    unshuffle(tmp.data(), (size_t)raw, str, out.data());
+    return p;
+}
+
+} // namespace Compress
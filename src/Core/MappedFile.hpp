@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// ── MappedFile ────────────────────────────────────────────────────────────────
+// Read-only memory map of a whole file. Pages are faulted in on first touch,
+// so opening a multi-GB save is instant and a pass that reads only some of it
+// (a section table, one species' records) costs only the pages it touches.
+// `sequential` hints the OS to read ahead aggressively for front-to-back scans.
+struct MappedFile {
+    const uint8_t* data = nullptr;
+    size_t         size = 0;
+
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { close(); }
+
+#ifdef _WIN32
+    bool open(const std::string& path, bool sequential = true) {
+        close();
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                           sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER sz;
+        if (!GetFileSizeEx(file, &sz) || sz.QuadPart == 0) { close(); return false; }
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) { close(); return false; }
+        data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!data) { close(); return false; }
+        size = (size_t)sz.QuadPart;
+        return true;
+    }
+
+    void close() {
+        if (data) UnmapViewOfFile(data);
+        if (mapping) CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        data = nullptr; size = 0; mapping = nullptr; file = INVALID_HANDLE_VALUE;
+    }
+
+private:
+    HANDLE file    = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    bool open(const std::string& path, bool sequential = true) {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) { ::close(fd); return false; }
+        void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);   // the mapping keeps its own reference
+        if (p == MAP_FAILED) return false;
+        if (sequential) madvise(p, (size_t)st.st_size, MADV_SEQUENTIAL);
+        data = static_cast<const uint8_t*>(p);
+        size = (size_t)st.st_size;
+        return true;
+    }
+
+    void close() {
+        if (data) munmap(const_cast<uint8_t*>(data), size);
+        data = nullptr;
+        size = 0;
+    }
+#endif
+};
@@ -0,0 +1,123 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// ── Hardware performance counters ─────────────────────────────────────────────
+// Cycles, instructions, cache and branch misses of the calling thread, read
+// through Linux perf_event_open as one group so every read is a consistent
+// snapshot. Optional everywhere: open() fails softly when the kernel refuses
+// (perf_event_paranoid, containers, VMs without a virtual PMU) or on other
+// platforms, and events the CPU lacks are simply left out; status() says
+// which. Counts are scaled up if the kernel had to multiplex the group.
+
+enum PerfEvent : int {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,       // L1 data cache read misses
+    PERF_LLC_MISSES,       // last-level cache misses
+    PERF_BRANCH_MISSES,
+    PERF_EVENTS
+};
+
+inline const char* perfEventName(int e) {
+    static const char* names[PERF_EVENTS] = { "cycles", "instructions", "L1d misses", "LLC misses", "branch misses" };
+    return names[e];
+}
+
+struct PerfCounters {
+    PerfCounters() = default;
+    ~PerfCounters() { close(); }
+    PerfCounters(const PerfCounters&)            = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool active() const { return leader >= 0; }
+    bool has(int e) const { return slot[e] >= 0; }
+    const std::string& status() const { return why; }
+
+#ifdef __linux__
+    // Start counting on this thread; true if at least one event opened
+    bool open() {
+        close();
+        struct Spec { uint32_t type; uint64_t config; };
+        const Spec specs[PERF_EVENTS] = {
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8
+                                | PERF_COUNT_HW_CACHE_RESULT_MISS << 16 },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+            { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        };
+        std::string missing;
+        int firstErr = 0;
+        for (int e = 0; e < PERF_EVENTS; e++) {
+            perf_event_attr attr{};
+            attr.size           = sizeof(attr);
+            attr.type           = specs[e].type;
+            attr.config         = specs[e].config;
+            attr.disabled       = leader < 0;   // the group starts when its leader is enabled
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+            if (fd < 0) {
+                if (!firstErr) firstErr = errno;
+                missing += missing.empty() ? perfEventName(e) : std::string(", ") + perfEventName(e);
+                continue;
+            }
+            if (leader < 0) leader = fd;
+            fds[members] = fd;
+            slot[e]      = members++;
+        }
+        if (leader < 0) {
+            why = std::string("perf_event_open failed: ") + std::strerror(firstErr)
+                + (firstErr == EACCES || firstErr == EPERM ? " (see /proc/sys/kernel/perf_event_paranoid)" : "");
+            return false;
+        }
+        why = missing.empty() ? "all events available" : "unavailable: " + missing;
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        return true;
+    }
+
+    void close() {
+        for (int i = 0; i < members; i++) ::close(fds[i]);
+        for (int& s : slot) s = -1;
+        members = 0;
+        leader  = -1;
+    }
+
+    // Counts since open(); events that didn't open read 0
+    void read(uint64_t out[PERF_EVENTS]) const {
+        uint64_t buf[3 + PERF_EVENTS] = {};   // nr, time enabled, time running, values
+        bool ok = active() && ::read(leader, buf, sizeof(buf)) > 0 && buf[2] > 0;
+        double scale = ok && buf[2] < buf[1] ? (double)buf[1] / buf[2] : 1.0;
+        for (int e = 0; e < PERF_EVENTS; e++)
+            out[e] = ok && slot[e] >= 0 ? (uint64_t)(buf[3 + slot[e]] * scale) : 0;
+    }
+#else
+    bool open() { why = "hardware counters need Linux perf_event_open"; return false; }
+    void close() {}
+    void read(uint64_t out[PERF_EVENTS]) const { for (int e = 0; e < PERF_EVENTS; e++) out[e] = 0; }
+#endif
+
+private:
+    int         leader  = -1;
+    int         members = 0;
+    int         fds[PERF_EVENTS]  = {};
+    int         slot[PERF_EVENTS] = { -1, -1, -1, -1, -1 };   // index in a group read
+    std::string why = "not opened";
+};
+
+inline PerfCounters& perfCounters() {
+    static PerfCounters p;
+    return p;
+}
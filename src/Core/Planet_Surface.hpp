@@ -98,7 +98,8 @@ struct PlanetSurface {
     // ── Spawn helpers ─────────────────────────────────────────────────────────
 
     // Random non-ocean surface position (uniform over the sphere).
-    Vec3 randomLandPos(RNG& rng) const {
+    template <typename Rng>
+    Vec3 randomLandPos(Rng& rng) const {
         for (int i = 0; i < 300; ++i) {
             // Marsaglia (1972) method: uniform point on unit sphere
             float a = rng.range(0.f, 6.2831853f);
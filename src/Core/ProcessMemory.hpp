@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <Windows.h>
+#include <psapi.h>
+#endif
+
+// ── Process memory ────────────────────────────────────────────────────────────
+// Resident set size of this process, for benchmark and soak reports. All
+// values are bytes; 0 means the platform doesn't say.
+
+#ifdef _WIN32
+inline size_t currentRSS() {
+    PROCESS_MEMORY_COUNTERS pmc{};
+    return GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)) ? pmc.WorkingSetSize : 0;
+}
+
+inline size_t peakRSS() {
+    PROCESS_MEMORY_COUNTERS pmc{};
+    return GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)) ? pmc.PeakWorkingSetSize : 0;
+}
+
+// The peak working set can't be reset on Windows
+inline bool resetPeakRSS() { return false; }
+#else
+// A "Vm...:  1234 kB" line of /proc/self/status
+inline size_t procStatusBytes(const char* key) {
+    std::FILE* f = std::fopen("/proc/self/status", "r");
+    if (!f) return 0;
+    char   line[256];
+    size_t kb  = 0;
+    size_t len = std::strlen(key);
+    while (std::fgets(line, sizeof(line), f)) {
+        if (std::strncmp(line, key, len) == 0 && line[len] == ':') {
+            std::sscanf(line + len + 1, "%zu", &kb);
+            break;
+        }
+    }
+    std::fclose(f);
+    return kb * 1024;
+}
+
+inline size_t currentRSS() { return procStatusBytes("VmRSS"); }
+inline size_t peakRSS()    { return procStatusBytes("VmHWM"); }
+
+// Restart the peak from the current RSS, so a later peakRSS() covers only
+// what ran since (Linux 4.0+)
+inline bool resetPeakRSS() {
+    std::FILE* f = std::fopen("/proc/self/clear_refs", "w");
+    if (!f) return false;
+    bool ok = std::fputs("5", f) >= 0;
+    return std::fclose(f) == 0 && ok;
+}
+#endif
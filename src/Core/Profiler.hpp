@@ -0,0 +1,280 @@
+#pragma once
+#include "PerfCounters.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// ── Built-in profiler ─────────────────────────────────────────────────────────
+// Always-on stage timers for diagnosing slow frames without attaching Tracy.
+// PROFILE_SCOPE(stage) adds the scope's wall time to that stage's total for
+// the current frame (a stage entered several times per frame, like mesh
+// builds, sums); endFrame() then pushes every total into a fixed ring of
+// recent frames, from which the profiler panel draws percentiles and a
+// stacked frame-time graph. Nothing allocates after construction.
+//
+// Stages form a tree via their parent, so a panel can stack the children of
+// any stage and show the remainder as the parent's own time. The frame stage
+// is the wall time between frames as passed to endFrame(), so its remainder
+// includes vsync waits and everything not instrumented.
+//
+// Single-threaded: scopes must run on the thread that calls endFrame().
+//
+// Scopes also mark the thread's current stage for allocation tracking (see
+// AllocTracker below), so heap traffic is attributed the same way. While
+// perfCounters() is open they read the hardware counters on entry and exit
+// too, accumulating each stage's totals over the whole run (not the ring).
+// While trace() is recording, each scope is also kept as a trace event.
+
+enum ProfStage : int {
+    PROF_FRAME,
+    PROF_TICK,
+    PROF_TICK_PLANTS,
+    PROF_TICK_SPATIAL,
+    PROF_TICK_PERCEIVE,
+    PROF_TICK_ACT,
+    PROF_TICK_REPRODUCE,
+    PROF_TICK_CLEANUP,
+    PROF_TICK_SPECIES,
+    PROF_RECORDING,
+    PROF_QUADTREE,
+    PROF_MESH_BUILD,
+    PROF_RENDER,
+    PROF_INSTANCES,
+    PROF_UI,
+    PROF_PRESENT,
+    PROF_STAGES
+};
+
+struct ProfStageInfo {
+    const char* name;
+    int         parent;   // -1 for the frame
+};
+
+inline const ProfStageInfo& profStageInfo(int s) {
+    static const ProfStageInfo info[PROF_STAGES] = {
+        { "Frame",             -1           },
+        { "Simulation tick",   PROF_FRAME   },
+        { "Plants",            PROF_TICK    },
+        { "Spatial hash",      PROF_TICK    },
+        { "Perception",        PROF_TICK    },
+        { "Creature update",   PROF_TICK    },
+        { "Reproduction",      PROF_TICK    },
+        { "Remove dead",       PROF_TICK    },
+        { "Species centroids", PROF_TICK    },
+        { "Recording & saves", PROF_FRAME   },
+        { "Planet quadtree",   PROF_FRAME   },
+        { "Mesh builds",       PROF_QUADTREE },
+        { "Render",            PROF_FRAME   },
+        { "Instance packing",  PROF_RENDER  },
+        { "UI",                PROF_FRAME   },
+        { "Present",           PROF_FRAME   },
+    };
+    return info[s];
+}
+
+inline int profStageDepth(int s) {
+    int d = 0;
+    while ((s = profStageInfo(s).parent) >= 0) d++;
+    return d;
+}
+
+// True if `s` is `root` or one of its descendants
+inline bool profStageWithin(int s, int root) {
+    for (; s >= 0; s = profStageInfo(s).parent)
+        if (s == root) return true;
+    return false;
+}
+
+// Innermost stage scope open on this thread, -1 outside any
+inline thread_local int t_profStage = -1;
+
+// ── Allocation tracking ───────────────────────────────────────────────────────
+// Heap allocations and bytes by the innermost stage they happen in. Counting
+// needs the global operator new replacements in Core/AllocHooks.cpp, which
+// only executables that want it compile in (the headless runner and the
+// benchmarks); elsewhere `hooked` stays false and the counters stay zero.
+// Allocations on threads outside any stage (workers, the main loop between
+// stages) land in the OUTSIDE slot.
+struct AllocTracker {
+    static constexpr int OUTSIDE = PROF_STAGES;
+    static constexpr int SLOTS   = PROF_STAGES + 1;
+
+    bool hooked = false;   // set by AllocHooks.cpp during static init
+
+    void record(size_t n) {
+        int s = t_profStage < 0 ? OUTSIDE : t_profStage;
+        count[s].fetch_add(1, std::memory_order_relaxed);
+        bytes[s].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    // Plain copy of the counters; diff two to get an interval's traffic
+    struct Totals {
+        uint64_t count[SLOTS] = {};
+        uint64_t bytes[SLOTS] = {};
+
+        Totals since(const Totals& prev) const {
+            Totals d;
+            for (int s = 0; s < SLOTS; s++) {
+                d.count[s] = count[s] - prev.count[s];
+                d.bytes[s] = bytes[s] - prev.bytes[s];
+            }
+            return d;
+        }
+        uint64_t countAll() const { uint64_t n = 0; for (uint64_t c : count) n += c; return n; }
+        uint64_t bytesAll() const { uint64_t n = 0; for (uint64_t b : bytes) n += b; return n; }
+        // Stage `root` and everything under it
+        uint64_t countWithin(int root) const {
+            uint64_t n = 0;
+            for (int s = 0; s < PROF_STAGES; s++) n += profStageWithin(s, root) ? count[s] : 0;
+            return n;
+        }
+    };
+
+    Totals totals() const {
+        Totals t;
+        for (int s = 0; s < SLOTS; s++) {
+            t.count[s] = count[s].load(std::memory_order_relaxed);
+            t.bytes[s] = bytes[s].load(std::memory_order_relaxed);
+        }
+        return t;
+    }
+
+private:
+    std::atomic<uint64_t> count[SLOTS] = {};
+    std::atomic<uint64_t> bytes[SLOTS] = {};
+};
+
+inline AllocTracker& allocTracker() {
+    static AllocTracker t;
+    return t;
+}
+
+struct Profiler {
+    static constexpr int RING = 600;   // frames kept: 10 s at 60 fps
+
+    bool enabled = true;               // false freezes the history for inspection
+
+    void add(int stage, int64_t ns) { cur[stage] += ns; }
+
+    void addPerf(int stage, const uint64_t* before, const uint64_t* after) {
+        for (int e = 0; e < PERF_EVENTS; e++) perfTotal[stage][e] += after[e] - before[e];
+    }
+    // Hardware counter totals of a stage since the counters were opened
+    const uint64_t* perf(int stage) const { return perfTotal[stage]; }
+
+    // Close the current frame. frameSeconds is its wall time (it becomes the
+    // frame stage); ticked says whether the simulation advanced, for UPS.
+    void endFrame(double frameSeconds, bool ticked) {
+        cur[PROF_FRAME] = (int64_t)(frameSeconds * 1e9);
+        trace().endFrame(frameSeconds);
+        if (enabled) {
+            for (int s = 0; s < PROF_STAGES; s++) ring[s][head] = (float)(cur[s] * 1e-6);
+            upsRing[head] = ticked && frameSeconds > 1e-6 ? (float)(1.0 / frameSeconds) : 0.f;
+            head  = (head + 1) % RING;
+            count = std::min(count + 1, RING);
+        }
+        std::fill(cur, cur + PROF_STAGES, 0);
+
+        // Rates over a 0.5 s window; 1% lows over the ring
+        winFrames++;
+        winTicks += ticked;
+        winTime  += frameSeconds;
+        if (winTime >= 0.5) {
+            fps = (float)(winFrames / winTime);
+            ups = (float)(winTicks / winTime);
+            winFrames = winTicks = 0;
+            winTime   = 0.0;
+            float p99 = percentile(PROF_FRAME, 99.f);
+            fps1Low = p99 > 0.f ? 1000.f / p99 : 0.f;
+            ups1Low = percentileOf(upsRing, 1.f);
+        }
+    }
+
+    int frames() const { return count; }
+
+    // Stage time in ms of the i-th kept frame, oldest first
+    float sample(int stage, int i) const {
+        return ring[stage][(head - count + i + RING) % RING];
+    }
+
+    struct Stats { float mean = 0, p50 = 0, p99 = 0, max = 0; };
+
+    Stats stats(int stage) const {
+        Stats st;
+        if (count == 0) return st;
+        double sum = 0;
+        for (int i = 0; i < count; i++) {
+            float v = sample(stage, i);
+            sum   += v;
+            st.max = std::max(st.max, v);
+        }
+        st.mean = (float)(sum / count);
+        st.p50  = percentile(stage, 50.f);
+        st.p99  = percentile(stage, 99.f);
+        return st;
+    }
+
+    float percentile(int stage, float pct) const { return percentileOf(ring[stage], pct); }
+
+    // Frames / simulation updates per second, and their 1% lows
+    float fps = 0.f, ups = 0.f, fps1Low = 0.f, ups1Low = 0.f;
+
+private:
+    int64_t cur[PROF_STAGES]        = {};
+    uint64_t perfTotal[PROF_STAGES][PERF_EVENTS] = {};
+    float   ring[PROF_STAGES][RING] = {};
+    float   upsRing[RING]           = {};
+    int     head = 0, count = 0;
+    int     winFrames = 0, winTicks = 0;
+    double  winTime   = 0.0;
+
+    float percentileOf(const float* r, float pct) const {
+        if (count == 0) return 0.f;
+        float tmp[RING];
+        for (int i = 0; i < count; i++) tmp[i] = r[(head - count + i + RING) % RING];
+        int k = std::min(count - 1, (int)(pct * 0.01f * count));
+        std::nth_element(tmp, tmp + k, tmp + count);
+        return tmp[k];
+    }
+};
+
+inline Profiler& profiler() {
+    static Profiler p;
+    return p;
+}
+
+struct ProfileScope {
+    using Clock = std::chrono::steady_clock;
+
+    explicit ProfileScope(int s) : stage(s), outer(t_profStage), counting(perfCounters().active()) {
+        t_profStage = s;
+        if (counting) perfCounters().read(perf0);
+        t0 = Clock::now();
+    }
+    ~ProfileScope() {
+        Clock::time_point t1 = Clock::now();
+        profiler().add(stage, std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+        trace().complete(profStageInfo(stage).name, TRACE_STAGE, t0, t1);
+        if (counting) {
+            uint64_t perf1[PERF_EVENTS];
+            perfCounters().read(perf1);
+            profiler().addPerf(stage, perf0, perf1);
+        }
+        t_profStage = outer;
+    }
+    ProfileScope(const ProfileScope&)            = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    int               stage;
+    int               outer;   // enclosing stage, restored on exit
+    bool              counting;
+    uint64_t          perf0[PERF_EVENTS];
+    Clock::time_point t0;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b)  PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(stage)  ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(stage)
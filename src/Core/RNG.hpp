@@ -2,12 +2,124 @@
 #include <cstdint>
 #include <cmath>
 
+// ── Ziggurat tables ───────────────────────────────────────────────────────────
+// Marsaglia & Tsang's 128-layer ziggurat for the standard normal: layers of
+// equal area under the density, so a draw lands wholly inside its layer's
+// rectangle ~99% of the time and costs one table compare and a multiply.
+// Only the rest fall back to an exp() edge test or the tail sampler.
+struct ZigguratTables {
+    static constexpr int    LAYERS = 128;
+    static constexpr double R      = 3.442619855899;        // start of the tail
+    static constexpr double V      = 9.91256303526217e-3;   // area of each layer
+
+    uint32_t k[LAYERS];   // |x| below k[i] (scaled by 2^31) is inside layer i
+    double   w[LAYERS];   // layer i's width / 2^31
+    double   f[LAYERS];   // density at layer i's outer edge
+
+    ZigguratTables() {
+        const double m = 2147483648.0;   // 2^31
+        double dn = R, tn = R;
+        double q  = V / std::exp(-0.5 * dn * dn);
+        k[0] = (uint32_t)(dn / q * m);
+        k[1] = 0;
+        w[0] = q / m;
+        w[LAYERS - 1] = dn / m;
+        f[0] = 1.0;
+        f[LAYERS - 1] = std::exp(-0.5 * dn * dn);
+        for (int i = LAYERS - 2; i >= 1; i--) {
+            dn = std::sqrt(-2.0 * std::log(V / dn + std::exp(-0.5 * dn * dn)));
+            k[i + 1] = (uint32_t)(dn / tn * m);
+            tn = dn;
+            f[i] = std::exp(-0.5 * dn * dn);
+            w[i] = dn / m;
+        }
+    }
+};
+
+inline const ZigguratTables& zigguratTables() {
+    static const ZigguratTables t;
+    return t;
+}
+
+// ── Draw helpers ──────────────────────────────────────────────────────────────
+// The float draws shared by every generator below, built on the derived
+// type's next(). CRTP rather than virtuals so the calls inline in hot loops.
+template <typename Derived>
+struct RandomDraws {
+    // Returns a uniform float in [0, 1).
+    // We shift right by 11 to get a 53-bit integer, then divide by 2^53,
+    // matching the mantissa precision of IEEE 754 doubles (and floats).
+    float uniform() {
+        return (self().next() >> 11) * (1.0f / (1ULL << 53));
+    }
+
+    // Returns a uniform float in [lo, hi)
+    float range(float lo, float hi) { return lo + uniform() * (hi - lo); }
+
+    // Normal distribution via the ziggurat (see ZigguratTables). One 64-bit
+    // draw supplies both the layer (low 7 bits) and the signed position
+    // (high 32 bits), so the common path needs no transcendental functions.
+    float normal(float mean = 0.f, float stddev = 1.f) {
+        return mean + (float)standardNormal() * stddev;
+    }
+
+    // The previous sampler, kept as a reference for KyberBenchSim.
+    // Box-Muller converts two uniform samples into two independent standard-
+    // normal values; we use one and discard the other for simplicity.
+    // The 1e-7f offset prevents log(0) if uniform() returns exactly 0.
+    float normalBoxMuller(float mean = 0.f, float stddev = 1.f) {
+        float u = uniform() + 1e-7f;
+        float v = uniform();
+        float n = std::sqrt(-2.f * std::log(u)) * std::cos(6.2831853f * v);
+        return mean + n * stddev;
+    }
+
+    // Returns true with probability p ∈ [0, 1]
+    bool chance(float p) { return uniform() < p; }
+
+private:
+    Derived& self() { return static_cast<Derived&>(*this); }
+
+    // Uniform in (0, 1]: safe to take the log of
+    double uniformOpen() { return ((self().next() >> 11) + 1) * (1.0 / (1ULL << 53)); }
+
+    double standardNormal() {
+        const ZigguratTables& z = zigguratTables();
+        for (;;) {
+            uint64_t bits = self().next();
+            int      i    = (int)(bits & (ZigguratTables::LAYERS - 1));
+            int32_t  h    = (int32_t)(bits >> 32);
+            double   x    = h * z.w[i];
+            if ((uint32_t)(h < 0 ? -(int64_t)h : h) < z.k[i]) return x;   // inside the rectangle
+
+            if (i == 0) {
+                // Base layer overhang: sample the tail beyond R (Marsaglia 1964)
+                double tx, ty;
+                do {
+                    tx = -std::log(uniformOpen()) / ZigguratTables::R;
+                    ty = -std::log(uniformOpen());
+                } while (ty + ty < tx * tx);
+                return h > 0 ? ZigguratTables::R + tx : -ZigguratTables::R - tx;
+            }
+            // Wedge between this layer's rectangle and the curve
+            if (z.f[i] + uniformOpen() * (z.f[i - 1] - z.f[i]) < std::exp(-0.5 * x * x)) return x;
+        }
+    }
+};
+
+// SplitMix64 finaliser: a bijective avalanche mix of one 64-bit word
+inline uint64_t splitMix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
 // ── xoshiro256** PRNG ─────────────────────────────────────────────────────────
 // A fast, high-quality 64-bit pseudo-random number generator.
 // "xoshiro" = XOR / Shift / Rotate. The "**" variant has excellent statistical
 // properties and passes all known randomness tests (BigCrush, PractRand).
 // State is 256 bits (4 × uint64). NOT cryptographically secure.
-struct RNG {
+struct RNG : RandomDraws<RNG> {
     uint64_t s[4];  // Internal 256-bit state; must never be all-zero
 
     // Seed the RNG using SplitMix64 to expand a single 64-bit seed into
@@ -17,10 +129,7 @@ struct RNG {
         auto sm = [](uint64_t& x) -> uint64_t {
             // SplitMix64: mix-then-advance on a counter
             x += 0x9e3779b97f4a7c15ULL;   // Knuth multiplicative constant (golden ratio)
-            uint64_t z = x;
-            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
-            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
-            return z ^ (z >> 31);
+            return splitMix64(x);
         };
         // Each call to sm() advances the counter and returns a fresh word
         s[0] = sm(seed); s[1] = sm(seed);
@@ -45,30 +154,6 @@ struct RNG {
         return result;
     }
 
-    // Returns a uniform float in [0, 1).
-    // We shift right by 11 to get a 53-bit integer, then divide by 2^53,
-    // matching the mantissa precision of IEEE 754 doubles (and floats).
-    float uniform() {
-        return (next() >> 11) * (1.0f / (1ULL << 53));
-    }
-
-    // Returns a uniform float in [lo, hi)
-    float range(float lo, float hi) { return lo + uniform() * (hi - lo); }
-
-    // Approximate normal distribution via Box-Muller transform.
-    // Box-Muller converts two uniform samples into two independent standard-
-    // normal values; we use one and discard the other for simplicity.
-    // The 1e-7f offset prevents log(0) if uniform() returns exactly 0.
-    float normal(float mean = 0.f, float stddev = 1.f) {
-        float u = uniform() + 1e-7f;
-        float v = uniform();
-        float n = std::sqrt(-2.f * std::log(u)) * std::cos(6.2831853f * v);
-        return mean + n * stddev;
-    }
-
-    // Returns true with probability p ∈ [0, 1]
-    bool chance(float p) { return uniform() < p; }
-
 private:
     // Bitwise left-rotation: moves high bits that would be lost by a left
     // shift back into the low positions, preserving all 64 bits of entropy.
@@ -77,9 +162,36 @@ private:
     }
 };
 
+// ── Counter-based RNG ─────────────────────────────────────────────────────────
+// A stateless-per-draw generator: the n-th value of a stream is a pure
+// function of (seed, stream, entity, tick, n), so no draw depends on how many
+// values anything else took before it. The simulation keys one per entity,
+// purpose and tick (World::rngFor), which keeps runs reproducible whatever
+// order entities are updated in, and lets any entity's draws be regenerated
+// in isolation. Construction is two mixes and each draw one, so it is cheap to
+// create on the spot; it is meant to be short-lived, not stored.
+enum RngStream : uint32_t {
+    RNG_SPAWN,     // per creature at birth: lifespan, starting drives
+    RNG_BIRTH,     // per mother at birth: offspring genomes and scatter
+    RNG_SLOPE,     // per creature: slope re-sample stagger
+    RNG_WATER,     // per creature: water search stagger
+    RNG_PLANTS,    // world-wide: spontaneous plant growth
+};
+
+struct CounterRNG : RandomDraws<CounterRNG> {
+    uint64_t key;            // mixed (seed, stream, entity, tick)
+    uint64_t counter = 0;    // draws taken
+
+    CounterRNG(uint64_t seed, uint32_t stream, uint32_t entity, uint64_t tick)
+        : key(splitMix64(splitMix64(seed ^ ((uint64_t)stream << 32 | entity)) ^ tick)) {}
+
+    uint64_t next() { return splitMix64(key + ++counter * 0x9e3779b97f4a7c15ULL); }
+};
+
 // ── Global RNG singleton ──────────────────────────────────────────────────────
 // Seeded once from wall-clock time so each run of the program is different.
-// Accessed via globalRNG() throughout the codebase; NOT thread-safe.
+// Only for nondeterministic UI actions (spawn buttons); the simulation draws
+// from World::rngFor. NOT thread-safe.
 #include <ctime>
 inline RNG& globalRNG() {
     static RNG rng(static_cast<uint64_t>(std::time(nullptr)));
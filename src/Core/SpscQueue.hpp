@@ -0,0 +1,58 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// ── SpscQueue ─────────────────────────────────────────────────────────────────
+// Bounded lock-free ring for exactly one producer thread and one consumer
+// thread. push() and pop() are wait-free: each side owns one index and only
+// reads the other's with acquire ordering, so an element's contents are
+// visible before the index that publishes it. Each side also caches the last
+// index it saw of the other, touching the shared cache line only when the
+// ring looks full (producer) or empty (consumer).
+//
+// Capacity must be a power of two; indices run freely and wrap by masking.
+template <typename T, size_t Capacity>
+struct SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscQueue capacity must be a power of two");
+
+    // Producer side. False (and nothing written) if the ring is full.
+    bool push(const T& v) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tailSeen >= Capacity) {
+            tailSeen = tail.load(std::memory_order_acquire);
+            if (h - tailSeen >= Capacity) return false;
+        }
+        buf[h & (Capacity - 1)] = v;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. False if the ring is empty.
+    bool pop(T& out) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == headSeen) {
+            headSeen = head.load(std::memory_order_acquire);
+            if (t == headSeen) return false;
+        }
+        out = buf[t & (Capacity - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate from either side; exact when the other side is idle
+    size_t size() const {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    // Producer and consumer state on separate cache lines so the two threads
+    // don't invalidate each other's writes
+    alignas(64) std::atomic<size_t> head{0};   // next slot to write
+    size_t                          tailSeen = 0;
+    alignas(64) std::atomic<size_t> tail{0};   // next slot to read
+    size_t                          headSeen = 0;
+    alignas(64) std::array<T, Capacity> buf{};
+};
@@ -0,0 +1,231 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+// ── Trace recorder ────────────────────────────────────────────────────────────
+// A flight recorder for rare stalls on machines with no Tracy client
+// attached. While started, every profiler stage scope (tick stages, mesh
+// builds, ...) and every TRACE_SCOPE (file and network I/O, worker jobs) is
+// kept as one complete event – name, thread, start, duration – in a fixed
+// ring that overwrites its oldest events, so the last few thousand frames
+// are always on hand. write() turns the ring into Chrome trace-event JSON,
+// which chrome://tracing and ui.perfetto.dev open directly.
+//
+// Recording is a few plain stores per scope, from any thread, and never
+// allocates after start(): each thread claims ring slots CLAIM at a time, so
+// the shared counter's atomic increment is paid once per CLAIM events. Event
+// names must outlive the recorder (string literals, profStageInfo names). A
+// dump races the writers: each slot carries a sequence number, and events
+// that were being overwritten while the dump read them are left out rather
+// than torn.
+//
+// endFrame() is the slow-frame trigger: a frame over `slowFrameMs` dumps the
+// ring to <stem>_slow_<n>.json, at most `maxSlowDumps` times per run and not
+// again until half the ring is new, so a run of slow frames (a load, the
+// first frames) costs one dump rather than the whole allowance. The dump
+// itself stalls the frame that triggers it, and appears in the next.
+
+enum TraceCategory : uint8_t {
+    TRACE_STAGE,   // profiler stage scopes
+    TRACE_IO,      // saves, loads, telemetry and other file work
+    TRACE_FRAME,   // whole frames, from endFrame()
+    TRACE_CATEGORIES
+};
+
+inline const char* traceCategoryName(int c) {
+    static const char* names[TRACE_CATEGORIES] = { "stage", "io", "frame" };
+    return names[c];
+}
+
+// Small per-thread number for the trace's tid column, assigned on first use
+inline thread_local uint32_t t_traceTid = 0;
+
+// This thread's claimed, not yet used ring slots [next, end) of `owner`
+struct TraceRecorder;
+struct TraceClaim {
+    const TraceRecorder* owner = nullptr;
+    uint64_t             next  = 0, end = 0;
+};
+inline thread_local TraceClaim t_traceClaim;
+
+struct TraceRecorder {
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 16;   // ~2.5 MB; a minute or more of frames
+    static constexpr int    MAX_THREADS      = 64;        // named threads
+    static constexpr int    CLAIM            = 16;        // slots a thread reserves at once
+
+    double      slowFrameMs  = 0.0;       // 0 = no slow-frame dumps
+    int         maxSlowDumps = 8;
+    std::string stem         = "trace";   // dump() file names start with this
+
+    TraceRecorder() = default;
+    TraceRecorder(const TraceRecorder&)            = delete;
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    // Allocate the ring (rounded up to a power of two) and start recording.
+    // Call before other threads record; not to be called twice.
+    void start(size_t capacity = DEFAULT_CAPACITY) {
+        size_t n = 1;
+        while (n < capacity) n <<= 1;
+        ring.reset(new Slot[n]);
+        mask  = n - 1;
+        epoch = Clock::now();
+        on.store(true, std::memory_order_release);
+    }
+
+    bool active() const { return on.load(std::memory_order_acquire); }
+    size_t capacity() const { return ring ? mask + 1 : 0; }
+    // Slots claimed so far: events recorded, plus claims not yet used up
+    uint64_t recorded() const { return head.load(std::memory_order_relaxed); }
+
+    void complete(const char* name, TraceCategory cat, Clock::time_point t0, Clock::time_point t1) {
+        if (!active()) return;
+        uint64_t i = claimSlot();
+        Slot& s = ring[i & mask];
+        s.seq.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        s.start.store(t0 > epoch ? ns(t0 - epoch) : 0, std::memory_order_relaxed);
+        s.dur.store(ns(t1 - t0), std::memory_order_relaxed);
+        s.name.store(name, std::memory_order_relaxed);
+        s.meta.store(threadId() << 8 | cat, std::memory_order_relaxed);
+        s.seq.store(i + 1, std::memory_order_release);
+    }
+
+    // Label the calling thread in dumps
+    void nameThread(const char* name) {
+        uint32_t tid = threadId();
+        if (tid < MAX_THREADS) threadNames[tid].store(name, std::memory_order_relaxed);
+    }
+
+    // Called once per frame by Profiler::endFrame(): records the frame and
+    // dumps the ring if it was slow
+    void endFrame(double frameSeconds) {
+        if (!active()) return;
+        Clock::time_point t1 = Clock::now();
+        complete("Frame", TRACE_FRAME, t1 - std::chrono::duration_cast<Clock::duration>(
+                                                 std::chrono::duration<double>(frameSeconds)), t1);
+        uint64_t now = recorded();
+        if (slowFrameMs > 0.0 && frameSeconds * 1e3 >= slowFrameMs && slowDumps < maxSlowDumps &&
+            (slowDumps == 0 || now - lastSlowDump >= capacity() / 2)) {
+            slowDumps++;
+            lastSlowDump = now;
+            dump("slow");
+        }
+    }
+
+    // Write the ring to <stem>_<reason>_<n>.json; returns the path, empty on failure
+    std::string dump(const char* reason) {
+        std::string path = stem + "_" + reason + "_" + std::to_string(dumps++) + ".json";
+        return write(path.c_str()) ? path : std::string();
+    }
+
+    // Chrome trace-event JSON of the events still in the ring
+    bool write(const char* path) const {
+        std::FILE* f = std::fopen(path, "w");
+        if (!f) return false;
+        std::fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        bool first = true;
+        uint32_t maxTid = 0;
+        uint64_t end = head.load(std::memory_order_acquire);
+        uint64_t begin = end > capacity() ? end - capacity() : 0;
+        for (uint64_t i = begin; i < end; i++) {
+            const Slot& s = ring[i & mask];
+            uint64_t seq = s.seq.load(std::memory_order_acquire);
+            uint64_t start = s.start.load(std::memory_order_relaxed);
+            uint64_t dur   = s.dur.load(std::memory_order_relaxed);
+            const char* name = s.name.load(std::memory_order_relaxed);
+            uint32_t meta  = s.meta.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seq != i + 1 || s.seq.load(std::memory_order_relaxed) != seq) continue;
+            uint32_t tid = meta >> 8;
+            maxTid = tid > maxTid ? tid : maxTid;
+            std::fprintf(f, "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,"
+                            "\"ts\":%.3f,\"dur\":%.3f}",
+                         first ? "" : ",\n", name, traceCategoryName(meta & 0xff), tid, start * 1e-3, dur * 1e-3);
+            first = false;
+        }
+        for (uint32_t t = 1; t <= maxTid && t < MAX_THREADS; t++) {
+            const char* n = threadNames[t].load(std::memory_order_relaxed);
+            if (!n) continue;
+            std::fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+                            "\"args\":{\"name\":\"%s\"}}", first ? "" : ",\n", t, n);
+            first = false;
+        }
+        std::fprintf(f, "\n]}\n");
+        return std::fclose(f) == 0;
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t>    seq{0};     // index + 1 once written, 0 while being written
+        std::atomic<uint64_t>    start{0};   // ns since start()
+        std::atomic<uint64_t>    dur{0};     // ns
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint32_t>    meta{0};    // tid << 8 | category
+    };
+
+    std::atomic<bool>        on{false};
+    std::atomic<uint64_t>    head{0};        // events ever recorded
+    std::unique_ptr<Slot[]>  ring;
+    size_t                   mask = 0;
+    Clock::time_point        epoch;
+    std::atomic<uint32_t>    nextTid{1};
+    std::atomic<const char*> threadNames[MAX_THREADS] = {};
+    int                      dumps        = 0;
+    int                      slowDumps    = 0;
+    uint64_t                 lastSlowDump = 0;   // recorded() at the last slow-frame dump
+
+    static uint64_t ns(Clock::duration d) {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+    }
+
+    // A claim half a ring old is dropped rather than used, so a thread that
+    // records rarely doesn't write behind the window a dump reads; unused
+    // claimed slots are skipped like torn ones
+    uint64_t claimSlot() {
+        TraceClaim& c = t_traceClaim;
+        if (c.owner != this || c.next == c.end || c.next + (mask + 1) / 2 < head.load(std::memory_order_relaxed)) {
+            c.owner = this;
+            c.next  = head.fetch_add(CLAIM, std::memory_order_relaxed);
+            c.end   = c.next + CLAIM;
+        }
+        return c.next++;
+    }
+
+    uint32_t threadId() {
+        if (!t_traceTid) t_traceTid = nextTid.fetch_add(1, std::memory_order_relaxed);
+        return t_traceTid;
+    }
+};
+
+inline TraceRecorder& trace() {
+    static TraceRecorder t;
+    return t;
+}
+
+// Records the enclosing scope as a trace event, on any thread; a flag test
+// when the recorder isn't running
+struct TraceScope {
+    explicit TraceScope(const char* n, TraceCategory c = TRACE_IO) : name(n), cat(c), on(trace().active()) {
+        if (on) t0 = TraceRecorder::Clock::now();
+    }
+    ~TraceScope() {
+        if (on) trace().complete(name, cat, t0, TraceRecorder::Clock::now());
+    }
+    TraceScope(const TraceScope&)            = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    const char*                      name;
+    TraceCategory                    cat;
+    bool                             on;
+    TraceRecorder::Clock::time_point t0;
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b)  TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name)   TraceScope TRACE_CONCAT(traceScope_, __LINE__)(name)
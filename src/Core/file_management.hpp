@@ -1,6 +1,88 @@
 #pragma once
+#include "Trace.hpp"
+#include <algorithm>
 #include <filesystem>
+#include <functional>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>        // _commit, _fileno
+#else
+#include <unistd.h>    // fsync, fileno
+#endif
 
 inline bool fileExists(const std::wstring& filename) {
     return std::filesystem::exists(filename);
-}
\ No newline at end of file
+}
+
+// Flush the OS page cache for an open stdio file down to the storage device.
+inline bool syncFile(std::FILE* f) {
+    if (std::fflush(f) != 0) return false;
+#ifdef _WIN32
+    return _commit(_fileno(f)) == 0;
+#else
+    return fsync(fileno(f)) == 0;
+#endif
+}
+
+// 64-bit absolute seek (plain fseek takes a 32-bit long on Windows).
+inline bool seekFile(std::FILE* f, uint64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(f, (long long)offset, SEEK_SET) == 0;
+#else
+    return fseeko(f, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
+
+// Atomically move a finished "<path>.tmp" over `path`.
+inline bool replaceFile(const std::string& tmp, const std::string& path) {
+    std::error_code ec;
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        // Some runtimes refuse to rename over an existing file; retry after removal
+        std::filesystem::remove(path, ec);
+        std::filesystem::rename(tmp, path, ec);
+    }
+    return !ec;
+}
+
+// Write `size` bytes to `path` crash-safely: the data goes to "<path>.tmp",
+// is fsync'd, and only then renamed over the destination. A power cut or crash
+// mid-write therefore leaves the previous file intact instead of a torn one.
+// `onProgress` (optional) receives the written fraction in [0,1] per chunk.
+inline bool writeFileDurable(const std::string& path, const uint8_t* data, size_t size,
+                             const std::function<void(float)>& onProgress = {}) {
+    TRACE_SCOPE("File write");
+    std::string tmp = path + ".tmp";
+    std::FILE* f = std::fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+
+    constexpr size_t CHUNK = 4u << 20;   // 4 MB per fwrite keeps progress responsive
+    bool ok = true;
+    for (size_t off = 0; off < size && ok; off += CHUNK) {
+        size_t n = std::min(CHUNK, size - off);
+        ok = std::fwrite(data + off, 1, n, f) == n;
+        if (onProgress) onProgress((float)(off + n) / (float)size);
+    }
+    ok = ok && syncFile(f);
+    ok = (std::fclose(f) == 0) && ok;
+    if (!ok) { std::remove(tmp.c_str()); return false; }
+    return replaceFile(tmp, path);
+}
+
+// Read a whole file into memory. Returns false if it can't be opened or read.
+inline bool readFileBytes(const std::string& path, std::vector<uint8_t>& out) {
+    TRACE_SCOPE("File read");
+    std::error_code ec;
+    uintmax_t size = std::filesystem::file_size(path, ec);   // 64-bit safe, unlike ftell
+    if (ec) return false;
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return false;
+    out.resize((size_t)size);
+    bool ok = std::fread(out.data(), 1, out.size(), f) == out.size();
+    std::fclose(f);
+    return ok;
+}
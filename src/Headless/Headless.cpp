@@ -0,0 +1,484 @@
+// KyberPlanet – headless simulation runner
+// Runs the world without a window or GPU: for long unattended runs, servers
+// and batch experiments. Population history goes to a telemetry stream.
+//
+//   KyberHeadless [--seed N] [--chunks N] [--load world.kybrp]
+//                 [--seconds S] [--dt D] [--max-pop N]
+//                 [--telemetry run.kybrt] [--sample-interval S]
+//                 [--save world.kybrp] [--quiet]
+//                 [--hash-trace FILE] [--hash-compare FILE]
+//                 [--assert-no-alloc WARMUP_TICKS] [--perf]
+//                 [--soak-report FILE] [--soak-interval TICKS]
+//                 [--costs EVERY_TICKS]
+//                 [--trace FILE] [--trace-slow MS] [--trace-capacity EVENTS]
+//   KyberHeadless --determinism [--seed N] [--seconds S] ...
+//   KyberHeadless --telemetry-csv run.kybrt out.csv [--from T] [--to T]
+#include "Core/Profiler.hpp"
+#include "Core/Trace.hpp"
+#include "World/World.hpp"
+#include "World/World_Hash.hpp"
+#include "Sim/DataRecorder.hpp"
+#include "Sim/Telemetry.hpp"
+#include "Soak.hpp"
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct HeadlessOptions {
+    uint64_t    seed           = 42;
+    int         chunks         = 16;
+    float       seconds        = 3600.f;   // sim seconds to run
+    float       dt             = 1.f / 60.f;
+    int         maxPop         = -1;       // -1 = SimConfig default
+    float       sampleInterval = 1.f;
+    std::string loadPath, savePath, telemetryPath;
+    bool        quiet          = false;
+
+    // Determinism checking: per-tick world hashes written to / compared
+    // against a trace, or the run done twice in-process
+    std::string hashTracePath, hashComparePath;
+    bool        determinism    = false;
+
+    // Fail the run if any tick after this many allocates (-1 = off)
+    int64_t     noAllocAfter   = -1;
+    bool        perf           = false;    // hardware counters per stage
+    uint32_t    costEvery      = 0;        // cost attribution sample period in ticks (0 = off)
+
+    // Trace recording (see Core/Trace.hpp); off without a trace path
+    std::string tracePath;
+    double      traceSlowMs    = 0.0;
+    size_t      traceCapacity  = TraceRecorder::DEFAULT_CAPACITY;
+
+    // Soak sampling (see Soak.hpp); off without a report path
+    std::string soakPath;
+    uint64_t    soakInterval   = 36000;
+
+    // --telemetry-csv mode
+    std::string csvIn, csvOut;
+    float       from = -1e30f, to = 1e30f;
+};
+
+static void usage() {
+    std::fprintf(stderr,
+        "usage: KyberHeadless [--seed N] [--chunks N] [--load FILE] [--seconds S]\n"
+        "                     [--dt D] [--max-pop N] [--telemetry FILE]\n"
+        "                     [--sample-interval S] [--save FILE] [--quiet]\n"
+        "                     [--hash-trace FILE] [--hash-compare FILE]\n"
+        "                     [--assert-no-alloc WARMUP_TICKS] [--perf]\n"
+        "                     [--soak-report FILE] [--soak-interval TICKS]\n"
+        "                     [--costs EVERY_TICKS]\n"
+        "                     [--trace FILE] [--trace-slow MS] [--trace-capacity EVENTS]\n"
+        "       KyberHeadless --determinism [--seed N] [--seconds S] [--dt D] ...\n"
+        "       KyberHeadless --telemetry-csv IN OUT [--from T] [--to T]\n");
+}
+
+static bool parseArgs(int argc, char** argv, HeadlessOptions& o) {
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if      (a == "--quiet")                          o.quiet = true;
+        else if (a == "--determinism")                    o.determinism = true;
+        else if (a == "--perf")                           o.perf = true;
+        else if (a == "--hash-trace"      && (v = next())) o.hashTracePath = v;
+        else if (a == "--hash-compare"    && (v = next())) o.hashComparePath = v;
+        else if (a == "--assert-no-alloc" && (v = next())) o.noAllocAfter = std::atoll(v);
+        else if (a == "--soak-report"     && (v = next())) o.soakPath = v;
+        else if (a == "--soak-interval"   && (v = next())) o.soakInterval = std::strtoull(v, nullptr, 10);
+        else if (a == "--costs"           && (v = next())) o.costEvery = (uint32_t)std::strtoul(v, nullptr, 10);
+        else if (a == "--trace"           && (v = next())) o.tracePath = v;
+        else if (a == "--trace-slow"      && (v = next())) o.traceSlowMs = std::atof(v);
+        else if (a == "--trace-capacity"  && (v = next())) o.traceCapacity = std::strtoull(v, nullptr, 10);
+        else if (a == "--seed"            && (v = next())) o.seed = std::strtoull(v, nullptr, 10);
+        else if (a == "--chunks"          && (v = next())) o.chunks = std::atoi(v);
+        else if (a == "--seconds"         && (v = next())) o.seconds = (float)std::atof(v);
+        else if (a == "--dt"              && (v = next())) o.dt = (float)std::atof(v);
+        else if (a == "--max-pop"         && (v = next())) o.maxPop = std::atoi(v);
+        else if (a == "--sample-interval" && (v = next())) o.sampleInterval = (float)std::atof(v);
+        else if (a == "--load"            && (v = next())) o.loadPath = v;
+        else if (a == "--save"            && (v = next())) o.savePath = v;
+        else if (a == "--telemetry"       && (v = next())) o.telemetryPath = v;
+        else if (a == "--from"            && (v = next())) o.from = (float)std::atof(v);
+        else if (a == "--to"              && (v = next())) o.to = (float)std::atof(v);
+        else if (a == "--telemetry-csv" && i + 2 < argc) { o.csvIn = argv[++i]; o.csvOut = argv[++i]; }
+        else return false;
+    }
+    return o.dt > 0.f && o.chunks > 0 && o.soakInterval > 0 && o.traceCapacity > 0;
+}
+
+// Fresh world for a run, generated (or loaded) from the options; the
+// simulation's draws are keyed by the world seed, so the same options give
+// the same run
+static bool setupWorld(World& world, const HeadlessOptions& opt) {
+    world.generate(opt.seed, opt.chunks, opt.chunks);
+    if (!opt.loadPath.empty() && !world.loadFromFile(opt.loadPath.c_str())) {
+        std::fprintf(stderr, "failed to load %s\n", opt.loadPath.c_str());
+        return false;
+    }
+    if (opt.maxPop > 0) world.cfg.maxPopulation = opt.maxPop;
+    world.cfg.paused   = false;
+    world.cfg.simSpeed = 1.f;   // dt below is already in sim seconds
+    return true;
+}
+
+static void printHashDivergence(uint64_t tick, float simTime, const WorldHash& expected, const WorldHash& got) {
+    std::printf("diverged at tick %llu (t=%.3f):", (unsigned long long)tick, simTime);
+    for (int f = 0; f < WH_FIELDS; f++)
+        if (expected.field[f] != got.field[f]) std::printf(" %s", worldHashFieldName(f));
+    std::printf("\n");
+}
+
+// ── Hardware counters ─────────────────────────────────────────────────────────
+// Per creature per tick for the creature passes, per tick otherwise; events
+// that didn't open print as "-"
+static void printPerfTable(uint64_t ticks, uint64_t creatureTicks) {
+    const PerfCounters& pc = perfCounters();
+    std::printf("hardware counters (per creature-tick for creature stages, else per tick)\n"
+                "  %-38s %12s %12s %6s %11s %11s %11s\n",
+                "stage", "cycles", "instr", "IPC", "L1d miss", "LLC miss", "br miss");
+    auto cell = [&](int e, const uint64_t* v, double div, int width) {
+        if (pc.has(e)) std::printf(" %*.1f", width, v[e] / div);
+        else           std::printf(" %*s", width, "-");
+    };
+    for (int s = PROF_TICK; s <= PROF_RECORDING; s++) {
+        const uint64_t* v = profiler().perf(s);
+        bool   perCreature = s == PROF_TICK_PERCEIVE || s == PROF_TICK_ACT;
+        double div = (double)(perCreature ? creatureTicks : ticks);
+        if (div <= 0.0) continue;
+        std::printf("  %*s%-*s", profStageDepth(s) * 2 - 2, "", 38 - (profStageDepth(s) * 2 - 2), profStageInfo(s).name);
+        cell(PERF_CYCLES, v, div, 12);
+        cell(PERF_INSTRUCTIONS, v, div, 12);
+        if (pc.has(PERF_CYCLES) && pc.has(PERF_INSTRUCTIONS) && v[PERF_CYCLES])
+            std::printf(" %6.2f", (double)v[PERF_INSTRUCTIONS] / v[PERF_CYCLES]);
+        else
+            std::printf(" %6s", "-");
+        cell(PERF_L1D_MISSES, v, div, 11);
+        cell(PERF_LLC_MISSES, v, div, 11);
+        cell(PERF_BRANCH_MISSES, v, div, 11);
+        std::printf("\n");
+    }
+}
+
+// ── Cost attribution ──────────────────────────────────────────────────────────
+// One table per grouping; times are means per sampled creature-tick, shares
+// are of the sampled creature-ticks and of their summed cost
+static void printCostTables(const World& world) {
+    const CostAttribution& ca = world.costs;
+    const CostBin& all = ca.overall();
+    if (!all.samples) { std::printf("cost attribution: no ticks sampled\n"); return; }
+    std::printf("cost attribution: %llu sampled ticks, %llu creature-ticks, perceive %.2f us + act %.2f us per creature\n",
+                (unsigned long long)ca.sampledTicks(), (unsigned long long)all.samples,
+                all.perceiveNs * 1e-3 / all.samples, all.actNs * 1e-3 / all.samples);
+    for (int g = 0; g < COST_GROUPS; g++) {
+        std::printf("  %-24s %14s %8s %12s %10s %8s\n", costGroupName(g),
+                    "creature-ticks", "share", "perceive us", "act us", "cost");
+        for (const CostAttribution::Row& r : ca.rows(g, world)) {
+            if (!r.bin.samples) continue;
+            std::printf("    %-22s %14llu %7.1f%% %12.2f %10.2f %7.1f%%\n", r.label.c_str(),
+                        (unsigned long long)r.bin.samples, 100.0 * r.bin.samples / all.samples,
+                        r.bin.perceiveNs * 1e-3 / r.bin.samples, r.bin.actNs * 1e-3 / r.bin.samples,
+                        100.0 * r.bin.totalNs() / all.totalNs());
+        }
+    }
+}
+
+// ── Trace dumps on demand ─────────────────────────────────────────────────────
+// SIGUSR1 asks for a dump of the trace ring at the next tick boundary
+static volatile std::sig_atomic_t g_traceRequested = 0;
+static void onTraceSignal(int) { g_traceRequested = 1; }
+
+// ── Hash traces ───────────────────────────────────────────────────────────────
+// One text line per tick: tick number, combined hash, then each field hash
+static void writeHashLine(std::FILE* f, uint64_t tick, const WorldHash& h) {
+    std::fprintf(f, "%llu %016llx", (unsigned long long)tick, (unsigned long long)h.combined());
+    for (uint64_t v : h.field) std::fprintf(f, " %016llx", (unsigned long long)v);
+    std::fputc('\n', f);
+}
+
+static bool readHashLine(std::FILE* f, uint64_t& tick, WorldHash& h) {
+    char line[512];
+    while (std::fgets(line, sizeof(line), f)) {
+        if (line[0] == '#') continue;
+        char* p = line;
+        tick = std::strtoull(p, &p, 10);
+        std::strtoull(p, &p, 16);   // combined; implied by the fields
+        for (uint64_t& v : h.field) {
+            char* end;
+            v = std::strtoull(p, &end, 16);
+            if (end == p) return false;
+            p = end;
+        }
+        return true;
+    }
+    return false;
+}
+
+// ── Determinism mode ──────────────────────────────────────────────────────────
+// Run the same options twice in this process, hashing every tick. At the
+// first tick that differs, replay the first run to it and name the first
+// entity and field that differ.
+static int runDeterminismCheck(const HeadlessOptions& opt) {
+    std::vector<WorldHash> hashes;
+    {
+        auto a = std::make_unique<World>();
+        if (!setupWorld(*a, opt)) return 1;
+        float endTime = a->simTime + opt.seconds;
+        while (a->simTime < endTime && !a->creatures.empty()) {
+            a->tick(opt.dt);
+            hashes.push_back(hashWorld(*a));
+        }
+    }
+    std::fprintf(stderr, "first run: %zu ticks\n", hashes.size());
+
+    auto b = std::make_unique<World>();
+    if (!setupWorld(*b, opt)) return 1;
+    for (size_t t = 0; t < hashes.size(); t++) {
+        b->tick(opt.dt);
+        WorldHash h = hashWorld(*b);
+        if (h == hashes[t]) continue;
+
+        printHashDivergence(t + 1, b->simTime, hashes[t], h);
+        auto a = std::make_unique<World>();
+        setupWorld(*a, opt);
+        for (size_t k = 0; k <= t; k++) a->tick(opt.dt);
+        std::printf("first difference: %s\n", describeWorldDifference(*a, *b).c_str());
+        return 1;
+    }
+    std::printf("deterministic over %zu ticks, final hash %016llx\n", hashes.size(),
+                hashes.empty() ? 0ull : (unsigned long long)hashes.back().combined());
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    HeadlessOptions opt;
+    if (!parseArgs(argc, argv, opt)) { usage(); return 2; }
+
+    // ── Converter mode ────────────────────────────────────────────────────────
+    if (!opt.csvIn.empty()) {
+        if (!telemetryToCSV(opt.csvIn, opt.csvOut, opt.from, opt.to)) {
+            std::fprintf(stderr, "failed to convert %s\n", opt.csvIn.c_str());
+            return 1;
+        }
+        return 0;
+    }
+    if (opt.determinism) return runDeterminismCheck(opt);
+
+    // ── World setup ───────────────────────────────────────────────────────────
+    // Static: World and DataRecorder are large and the recorder owns a thread
+    static World        world;
+    static DataRecorder recorder;
+    if (!setupWorld(world, opt)) return 1;
+    recorder.sampleInterval = opt.sampleInterval;
+
+    std::FILE* hashTrace   = nullptr;
+    std::FILE* hashCompare = nullptr;
+    if (!opt.hashTracePath.empty()) {
+        hashTrace = std::fopen(opt.hashTracePath.c_str(), "w");
+        if (!hashTrace) { std::fprintf(stderr, "failed to open %s\n", opt.hashTracePath.c_str()); return 1; }
+        std::fprintf(hashTrace, "# KyberHeadless hash trace: seed %llu, dt %g; tick combined",
+                     (unsigned long long)opt.seed, opt.dt);
+        for (int f = 0; f < WH_FIELDS; f++) std::fprintf(hashTrace, " %s", worldHashFieldName(f));
+        std::fputc('\n', hashTrace);
+    }
+    if (!opt.hashComparePath.empty()) {
+        hashCompare = std::fopen(opt.hashComparePath.c_str(), "r");
+        if (!hashCompare) { std::fprintf(stderr, "failed to open %s\n", opt.hashComparePath.c_str()); return 1; }
+    }
+    bool diverged = false;
+
+    // Steady-state allocation check: every tick after the warm-up must leave
+    // the heap alone. The first offender is itemised by stage.
+    uint64_t allocTicks = 0;
+    auto checkTickAllocs = [&](uint64_t tick, const AllocTracker::Totals& d) {
+        if (opt.noAllocAfter < 0 || tick <= (uint64_t)opt.noAllocAfter || d.countWithin(PROF_TICK) == 0) return;
+        if (allocTicks++ == 0) {
+            std::printf("tick %llu allocated:", (unsigned long long)tick);
+            for (int st = 0; st < PROF_STAGES; st++)
+                if (d.count[st] && profStageWithin(st, PROF_TICK))
+                    std::printf("  %s %llu (%llu bytes)", profStageInfo(st).name,
+                                (unsigned long long)d.count[st], (unsigned long long)d.bytes[st]);
+            std::printf("\n");
+        }
+    };
+
+    if (!opt.telemetryPath.empty() && !recorder.startTelemetry(opt.telemetryPath)) {
+        std::fprintf(stderr, "failed to open telemetry stream %s\n", opt.telemetryPath.c_str());
+        return 1;
+    }
+
+    // Optional: without counters the run goes ahead and just says why
+    if (opt.perf) {
+        bool ok = perfCounters().open();
+        std::fprintf(stderr, "hardware counters: %s\n", perfCounters().status().c_str());
+        if (!ok) std::fprintf(stderr, "continuing without hardware counters\n");
+    }
+
+    world.costs.enabled = opt.costEvery > 0;
+    world.costs.every   = opt.costEvery;
+
+    // The ring records from here on; dumps are named after the trace path
+    if (!opt.tracePath.empty()) {
+        TraceRecorder& tr = trace();
+        std::string stem = opt.tracePath;
+        if (stem.size() > 5 && stem.compare(stem.size() - 5, 5, ".json") == 0) stem.resize(stem.size() - 5);
+        tr.stem        = stem;
+        tr.slowFrameMs = opt.traceSlowMs;
+        tr.start(opt.traceCapacity);
+        tr.nameThread("main");
+#ifdef SIGUSR1
+        std::signal(SIGUSR1, onTraceSignal);
+#endif
+    }
+
+    static SoakMonitor soak;
+    soak.interval = opt.soakInterval;
+    if (!opt.soakPath.empty() && !soak.open(opt.soakPath)) {
+        std::fprintf(stderr, "failed to open %s\n", opt.soakPath.c_str());
+        return 1;
+    }
+
+    // ── Main loop ─────────────────────────────────────────────────────────────
+    using Clock = std::chrono::steady_clock;
+    auto  start      = Clock::now();
+    float endTime    = world.simTime + opt.seconds;
+    float nextReport = world.simTime;
+    uint64_t ticks   = 0;
+    uint64_t creatureTicks = 0;   // population summed over ticks, for per-creature figures
+    uint64_t simEvents[SIM_EVENT_TYPES] = {};
+    auto  frameStart = start;
+    AllocTracker::Totals allocStart = allocTracker().totals();
+    while (world.simTime < endTime) {
+        AllocTracker::Totals beforeTick = allocTracker().totals();
+        size_t population = world.creatures.size();
+        creatureTicks += population;
+        world.tick(opt.dt);
+        checkTickAllocs(ticks + 1, allocTracker().totals().since(beforeTick));
+        {
+            PROFILE_SCOPE(PROF_RECORDING);
+            recorder.tick(opt.dt, world);
+        }
+        ticks++;
+        auto frameEnd = Clock::now();
+        double frameSeconds = std::chrono::duration<double>(frameEnd - frameStart).count();
+        profiler().endFrame(frameSeconds, true);
+        soak.tick(ticks, frameSeconds * 1e3, population, world, recorder);
+        frameStart = frameEnd;
+
+        if (g_traceRequested) {
+            g_traceRequested = 0;
+            std::string path = trace().dump("demand");
+            if (path.empty()) std::fprintf(stderr, "trace dump failed\n");
+            else              std::fprintf(stderr, "trace written to %s\n", path.c_str());
+        }
+
+        if (hashTrace || hashCompare) {
+            WorldHash h = hashWorld(world);
+            if (hashTrace) writeHashLine(hashTrace, ticks, h);
+            uint64_t   refTick;
+            WorldHash  ref;
+            if (hashCompare && readHashLine(hashCompare, refTick, ref) && refTick == ticks && ref != h) {
+                printHashDivergence(ticks, world.simTime, ref, h);
+                diverged = true;
+                break;
+            }
+        }
+
+        // Drain the event bus; population alerts go to the log
+        SimEvent se;
+        while (world.eventBus.poll(se)) {
+            simEvents[(int)se.type]++;
+            if (opt.quiet || se.type == SimEventType::SpeciesFormed
+                          || se.type == SimEventType::SpeciesExtinct) continue;
+            if (se.limit) std::fprintf(stderr, "t=%9.0f  %s: %u of %u\n",
+                                       se.simTime, simEventName(se.type), se.count, se.limit);
+            else          std::fprintf(stderr, "t=%9.0f  %s: %u\n",
+                                       se.simTime, simEventName(se.type), se.count);
+        }
+
+        if (!opt.quiet && world.simTime >= nextReport) {
+            nextReport += 60.f;
+            double wall = std::chrono::duration<double>(Clock::now() - start).count();
+            std::fprintf(stderr, "t=%9.0f  pop=%6zu  species=%5zu  %.0f ticks/s\n",
+                         world.simTime, world.creatures.size(), world.species.size(),
+                         wall > 0.0 ? ticks / wall : 0.0);
+        }
+        if (world.creatures.empty()) {
+            std::fprintf(stderr, "population extinct at t=%.0f\n", world.simTime);
+            break;
+        }
+    }
+
+    if (!opt.soakPath.empty()) {
+        soak.close();
+        soak.report(stdout);
+    }
+    if (hashTrace)   std::fclose(hashTrace);
+    if (hashCompare) std::fclose(hashCompare);
+
+    recorder.stopTelemetry();
+    if (recorder.telemetry.recordsRejected() > 0)
+        std::fprintf(stderr, "%llu samples not appended: %s already extends past t=%.0f\n",
+                     (unsigned long long)recorder.telemetry.recordsRejected(),
+                     opt.telemetryPath.c_str(), world.simTime);
+    if (recorder.telemetry.failed())
+        std::fprintf(stderr, "telemetry write error on %s\n", opt.telemetryPath.c_str());
+
+    bool saveFailed = !opt.savePath.empty() && !world.saveToFile(opt.savePath.c_str());
+    if (saveFailed) std::fprintf(stderr, "failed to save %s\n", opt.savePath.c_str());
+
+    // Written after the final save so its I/O is in the trace too
+    if (trace().active()) {
+        if (trace().write(opt.tracePath.c_str()))
+            std::fprintf(stderr, "trace written to %s (%llu events recorded, ring holds %zu)\n", opt.tracePath.c_str(),
+                         (unsigned long long)trace().recorded(), trace().capacity());
+        else
+            std::fprintf(stderr, "failed to write trace %s\n", opt.tracePath.c_str());
+    }
+    if (saveFailed) return 1;
+
+    double wall = std::chrono::duration<double>(Clock::now() - start).count();
+    std::printf("simTime %.1f  ticks %llu  wall %.1f s  pop %zu  births %llu  deaths %llu  speciations %llu\n",
+                world.simTime, (unsigned long long)ticks, wall, world.creatures.size(),
+                (unsigned long long)world.events.births, (unsigned long long)world.events.deaths,
+                (unsigned long long)world.events.speciations);
+
+    const World::EventCounters& ev = world.events;
+    std::printf("deaths by cause:");
+    for (int c = 0; c < (int)DeathCause::COUNT; c++)
+        std::printf("  %s %llu", deathCauseName((DeathCause)c), (unsigned long long)ev.deathsBy[c]);
+    std::printf("\ninteractions:  bites %llu  kills %llu  grazes %llu  drinks %llu  mates refused %llu\n",
+                (unsigned long long)ev.bites, (unsigned long long)ev.kills, (unsigned long long)ev.grazes,
+                (unsigned long long)ev.drinks, (unsigned long long)ev.mateRejections);
+    std::printf("events:");
+    for (int t = 0; t < SIM_EVENT_TYPES; t++)
+        std::printf("  %s %llu", simEventName((SimEventType)t), (unsigned long long)simEvents[t]);
+    std::printf("  (dropped %llu)\n", (unsigned long long)world.eventBus.droppedCount());
+
+    // Times over the profiler's window; allocations (the stage's own, not its
+    // children's) over the whole run
+    const Profiler& prof = profiler();
+    AllocTracker::Totals allocs = allocTracker().totals().since(allocStart);
+    double perTick = ticks ? 1.0 / ticks : 0.0;
+    std::printf("stage times over the last %d ticks (ms)       mean      p50      p99      max"
+                "  allocs/tick  bytes/tick\n", prof.frames());
+    for (int s = PROF_FRAME; s <= PROF_RECORDING; s++) {   // the stages a headless run enters
+        Profiler::Stats st = prof.stats(s);
+        int slot = s == PROF_FRAME ? AllocTracker::OUTSIDE : s;   // the loop outside any stage
+        std::printf("  %*s%-*s %8.3f %8.3f %8.3f %8.3f %12.2f %11.0f\n", profStageDepth(s) * 2, "",
+                    40 - profStageDepth(s) * 2, profStageInfo(s).name, st.mean, st.p50, st.p99, st.max,
+                    allocs.count[slot] * perTick, allocs.bytes[slot] * perTick);
+    }
+    if (perfCounters().active()) printPerfTable(ticks, creatureTicks);
+    if (world.costs.enabled) printCostTables(world);
+    if (opt.noAllocAfter >= 0) {
+        if (allocTicks) std::printf("FAIL: %llu ticks after tick %lld allocated\n",
+                                    (unsigned long long)allocTicks, (long long)opt.noAllocAfter);
+        else            std::printf("no allocations in any tick after tick %lld\n", (long long)opt.noAllocAfter);
+    }
+    return diverged || allocTicks > 0 ? 1 : 0;
+}
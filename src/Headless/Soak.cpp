@@ -0,0 +1,162 @@
+#include "Soak.hpp"
+#include "Core/ProcessMemory.hpp"
+#include <algorithm>
+#include <cmath>
+
+const SoakMetricInfo& soakMetricInfo(int m) {
+    static const SoakMetricInfo info[SM_COUNT] = {
+        { "rss_mb",            SOAK_SIZE    },
+        { "creatures",         SOAK_SIZE    },
+        { "creatures_cap",     SOAK_SIZE    },
+        { "id_map",            SOAK_SIZE    },
+        { "id_map_buckets",    SOAK_SIZE    },
+        { "plants",            SOAK_SIZE    },
+        { "plants_cap",        SOAK_SIZE    },
+        { "species",           SOAK_SIZE    },
+        { "species_cap",       SOAK_SIZE    },
+        { "live_species",      SOAK_SIZE    },
+        { "species_tracks",    SOAK_SIZE    },
+        { "next_id",           SOAK_COUNTER },
+        { "ticks_per_sec",     SOAK_INFO    },
+        { "p50_ms",            SOAK_INFO    },
+        { "p99_ms",            SOAK_COST    },
+        { "max_ms",            SOAK_INFO    },
+        { "ns_per_creature",   SOAK_COST    },
+    };
+    return info[m];
+}
+
+bool SoakMonitor::open(const std::string& path) {
+    close();
+    csv = std::fopen(path.c_str(), "w");
+    if (!csv) return false;
+    std::fprintf(csv, "tick,sim_time,wall_s");
+    for (int m = 0; m < SM_COUNT; m++) std::fprintf(csv, ",%s", soakMetricInfo(m).name);
+    std::fputc('\n', csv);
+    samples.clear();
+    latencies.clear();
+    latencies.reserve((size_t)interval);
+    intervalMs    = 0.0;
+    creatureTicks = 0.0;
+    start         = std::chrono::steady_clock::now();
+    return true;
+}
+
+void SoakMonitor::close() {
+    if (csv) std::fclose(csv);
+    csv = nullptr;
+}
+
+void SoakMonitor::tick(uint64_t tick, double ms, size_t population, const World& world, const DataRecorder& rec) {
+    if (!csv) return;
+    latencies.push_back((float)ms);
+    intervalMs    += ms;
+    creatureTicks += (double)population;
+    if (latencies.size() >= interval) sample(tick, world, rec);
+}
+
+static double percentileOf(std::vector<float>& v, double pct) {
+    size_t k = std::min(v.size() - 1, (size_t)(pct * 0.01 * v.size()));
+    std::nth_element(v.begin(), v.begin() + k, v.end());
+    return v[k];
+}
+
+void SoakMonitor::sample(uint64_t tick, const World& world, const DataRecorder& rec) {
+    Sample s;
+    s.tick    = tick;
+    s.simTime = world.simTime;
+    s.wall    = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    auto& v = s.v;
+    v[SM_RSS_MB]          = currentRSS() / 1048576.0;
+    v[SM_CREATURES]       = (double)world.creatures.size();
+    v[SM_CREATURES_CAP]   = (double)world.creatures.capacity();
+    v[SM_ID_MAP]          = (double)world.idToIndex.size();
+    v[SM_ID_MAP_BUCKETS]  = (double)world.idToIndex.bucket_count();
+    v[SM_PLANTS]          = (double)world.plants.size();
+    v[SM_PLANTS_CAP]      = (double)world.plants.capacity();
+    v[SM_SPECIES]         = (double)world.species.size();
+    v[SM_SPECIES_CAP]     = (double)world.species.capacity();
+    v[SM_LIVE_SPECIES]    = (double)world.liveSpecies.size();
+    v[SM_SPECIES_TRACKS]  = (double)rec.speciesHistory.trackCount();
+    v[SM_NEXT_ID]         = (double)world.nextID;
+    v[SM_TICKS_PER_SEC]   = intervalMs > 0.0 ? latencies.size() * 1000.0 / intervalMs : 0.0;
+    v[SM_P50_MS]          = percentileOf(latencies, 50.0);
+    v[SM_P99_MS]          = percentileOf(latencies, 99.0);
+    v[SM_MAX_MS]          = *std::max_element(latencies.begin(), latencies.end());
+    v[SM_NS_PER_CREATURE] = creatureTicks > 0.0 ? intervalMs * 1e6 / creatureTicks : 0.0;
+    samples.push_back(s);
+
+    std::fprintf(csv, "%llu,%.3f,%.1f", (unsigned long long)s.tick, s.simTime, s.wall);
+    for (double x : v) std::fprintf(csv, ",%.6g", x);
+    std::fputc('\n', csv);
+    std::fflush(csv);   // a soak may be killed rather than finish
+
+    latencies.clear();
+    intervalMs    = 0.0;
+    creatureTicks = 0.0;
+}
+
+// Mean of metric m over samples [a, b)
+static double meanOver(const std::vector<std::array<double, SM_COUNT>>& v, int m, size_t a, size_t b) {
+    double sum = 0.0;
+    for (size_t i = a; i < b; i++) sum += v[i][m];
+    return b > a ? sum / (b - a) : 0.0;
+}
+
+int SoakMonitor::report(std::FILE* out) const {
+    std::fprintf(out, "soak: %zu samples every %llu ticks\n", samples.size(), (unsigned long long)interval);
+    if (samples.size() < (size_t)MIN_SAMPLES) {
+        std::fprintf(out, "  too few samples to judge growth or drift (need %d)\n", MIN_SAMPLES);
+        return 0;
+    }
+
+    // The first sample covers warm-up: containers reaching their working size
+    std::vector<std::array<double, SM_COUNT>> v;
+    for (size_t i = 1; i < samples.size(); i++) v.push_back(samples[i].v);
+    size_t n = v.size();
+    double simSpan = samples.back().simTime - samples[1].simTime;
+
+    std::fprintf(out, "  %-18s %14s %14s %14s %14s\n", "metric", "first", "min", "max", "last");
+    for (int m = 0; m < SM_COUNT; m++) {
+        double lo = v[0][m], hi = v[0][m];
+        for (const auto& x : v) { lo = std::min(lo, x[m]); hi = std::max(hi, x[m]); }
+        std::fprintf(out, "  %-18s %14.6g %14.6g %14.6g %14.6g\n", soakMetricInfo(m).name, v[0][m], lo, hi, v[n - 1][m]);
+    }
+
+    int flags = 0;
+    for (int m = 0; m < SM_COUNT; m++) {
+        const SoakMetricInfo& info = soakMetricInfo(m);
+        double first = v[0][m], last = v[n - 1][m];
+        if (info.kind == SOAK_SIZE) {
+            // A single step after warm-up (a pool filling, a table being
+            // created) isn't a leak; growth has to go on through the run.
+            // The ratio test passes trivially for a metric that starts at
+            // zero, so one that then grows steadily is caught on persistence.
+            size_t rises = 0;
+            for (size_t i = 1; i < n; i++) rises += v[i][m] > v[i - 1][m];
+            bool persistent = rises * 4 >= (n - 1) * 3 && last > v[n / 2][m];
+            if (persistent && last >= first * GROWTH_FLAG) {
+                std::fprintf(out, "GROWTH  %-18s %.6g -> %.6g over %.0f sim s, rose in %zu of %zu intervals\n",
+                             info.name, first, last, simSpan, rises, n - 1);
+                flags++;
+            }
+        } else if (info.kind == SOAK_COUNTER) {
+            double rate = simSpan > 0.0 ? (last - first) / simSpan : 0.0;
+            if (rate > 0.0)
+                std::fprintf(out, "note    %-18s +%.3g per sim s; wraps at 2^32 in %.1f sim days\n",
+                             info.name, rate, (4294967296.0 - last) / rate / 86400.0);
+        } else if (info.kind == SOAK_COST) {
+            size_t q      = std::max<size_t>(1, n / 4);
+            double early  = meanOver(v, m, 0, q);
+            double late   = meanOver(v, m, n - q, n);
+            if (early > 0.0 && late >= early * DRIFT_FLAG) {
+                std::fprintf(out, "DRIFT   %-18s %.4g -> %.4g (first vs last quarter, %+.0f%%)\n",
+                             info.name, early, late, (late / early - 1.0) * 100.0);
+                flags++;
+            }
+        }
+    }
+    std::fprintf(out, "%d soak flag%s\n", flags, flags == 1 ? "" : "s");
+    return flags;
+}
@@ -0,0 +1,94 @@
+#pragma once
+// ── Soak monitoring ───────────────────────────────────────────────────────────
+// For long headless runs: every `interval` ticks, records process RSS, the
+// size and capacity of the containers that can grow without bound, species
+// counts and the tick latency distribution of the interval, as one CSV row.
+// At the end, report() looks for the two ways a multi-day session degrades:
+//
+//   growth  a size that rose in most intervals, was still rising in the
+//           second half of the run and ended well above where it started
+//           (the first interval is warm-up and excluded)
+//   drift   the cost per creature-tick, or the p99 tick, in the last quarter
+//           of the run well above the first quarter
+//
+// Flags are leads, not verdicts: nextID for one is meant to grow, and report()
+// says how long it has before it wraps.
+#include "World/World.hpp"
+#include "Sim/DataRecorder.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+enum SoakMetric : int {
+    SM_RSS_MB,
+    SM_CREATURES,
+    SM_CREATURES_CAP,
+    SM_ID_MAP,            // World::idToIndex entries
+    SM_ID_MAP_BUCKETS,
+    SM_PLANTS,
+    SM_PLANTS_CAP,
+    SM_SPECIES,           // registry entries, live or extinct
+    SM_SPECIES_CAP,
+    SM_LIVE_SPECIES,
+    SM_SPECIES_TRACKS,    // DataRecorder::speciesHistory tracks
+    SM_NEXT_ID,
+    SM_TICKS_PER_SEC,
+    SM_P50_MS,
+    SM_P99_MS,
+    SM_MAX_MS,
+    SM_NS_PER_CREATURE,   // wall ns per creature-tick
+    SM_COUNT
+};
+
+enum SoakKind : int {
+    SOAK_SIZE,      // checked for monotonic growth
+    SOAK_COUNTER,   // grows by design; projected to overflow
+    SOAK_COST,      // checked for drift
+    SOAK_INFO,
+};
+
+struct SoakMetricInfo {
+    const char* name;   // CSV column
+    SoakKind    kind;
+};
+const SoakMetricInfo& soakMetricInfo(int m);
+
+struct SoakMonitor {
+    static constexpr double GROWTH_FLAG = 1.25;   // ended ≥ 25% above the first post-warm-up sample
+                                                  // (any rise from 0), having risen in ≥ 3/4 of the intervals
+    static constexpr double DRIFT_FLAG  = 1.25;   // last quarter ≥ 25% costlier than the first
+    static constexpr int    MIN_SAMPLES = 5;      // below this report() only lists the samples
+
+    uint64_t interval = 36000;   // ticks between samples (10 sim minutes at 60 Hz)
+
+    // Fails if the report file can't be created
+    bool open(const std::string& path);
+    void close();
+
+    // Per tick: its wall time and the population it ran with. Samples once
+    // `interval` ticks have accumulated.
+    void tick(uint64_t tick, double ms, size_t population, const World& world, const DataRecorder& rec);
+
+    // Print the growth and drift analysis; returns the number of flags
+    int report(std::FILE* out) const;
+
+private:
+    struct Sample {
+        uint64_t tick    = 0;
+        float    simTime = 0.f;
+        double   wall    = 0.0;   // seconds since open()
+        std::array<double, SM_COUNT> v{};
+    };
+
+    std::FILE*          csv = nullptr;
+    std::vector<Sample> samples;
+    std::vector<float>  latencies;   // this interval's tick times, ms
+    double              intervalMs    = 0.0;
+    double              creatureTicks = 0.0;
+    std::chrono::steady_clock::time_point start;
+
+    void sample(uint64_t tick, const World& world, const DataRecorder& rec);
+};
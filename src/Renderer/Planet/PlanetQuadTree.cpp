@@ -19,6 +19,7 @@
 
 #include "PlanetQuadTree.hpp"
 #include "PlanetNoise.hpp"
+#include "Core/Profiler.hpp"
 #include <cmath>
 #include <algorithm>
 #include <vector>
@@ -35,6 +36,7 @@ static Vec3 surfacePos(int face, float u, float v, const PlanetConfig& cfg) {
 // Generates a patchRes × patchRes vertex grid for a leaf node.
 // Normals computed via central finite differences on the sphere surface.
 void PlanetFaceTree::buildMesh(PlanetNode* node, ID3D11Device* dev) {
+    PROFILE_SCOPE(PROF_MESH_BUILD);
     const int res = cfg.patchRes;   // e.g. 17
     const int quads = res - 1;
 
@@ -4,6 +4,7 @@
 
 #include "World/World.hpp"
 #include "World/World_Planet.hpp"
+#include "Core/Profiler.hpp"
 
 // ── Renderer_Creatures.cpp ────────────────────────────────────────────────────
 // Covers: hueToRGB, renderCreatures.
@@ -76,6 +77,8 @@ static bool isVisibleFromCamera(const Vec3& worldPos, const Float3& camPos) {
 //   - The GPU runs the vertex shader 4*N times, feeding each group of 4 vertices
 //     the same instance row, producing one billboard per creature.
 void Renderer::renderCreatures(const World& world) {
+    PROFILE_SCOPE(PROF_INSTANCES);
+
     // Lock the instance buffer so the CPU can write new creature data into it.
     // MAP_WRITE_DISCARD = discard old contents (no GPU sync needed).
     D3D11_MAPPED_SUBRESOURCE ms{};
@@ -19,6 +19,7 @@
 #include "Renderer.hpp"
 #include "World/World.hpp"
 #include "World/World_Planet.hpp"
+#include "Core/Profiler.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -51,6 +52,8 @@ static bool plantVisibleFromCamera(const Vec3& worldPos, const Float3& camPos) {
 }
 
 void Renderer::renderPlants(const World& world) {
+    PROFILE_SCOPE(PROF_INSTANCES);
+
     // Re-use the creature instance buffer. We do a separate Map/draw pass.
     D3D11_MAPPED_SUBRESOURCE ms{};
     ctx->Map(creatureInstanceVB.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &ms);
@@ -42,7 +42,7 @@ void Creature::wander(float spd, float dt) {
     steerToward(pos + w * 500.f, spd * 0.3f, dt);
 }
 
-float Creature::tick(float dt, World& world) {
+float Creature::tick(float dt, World& world, TickCounters& counters) {
     ZoneScoped;
     if (!alive) return 0.f;
 
@@ -63,7 +63,7 @@ float Creature::tick(float dt, World& world) {
     slopeTimer -= dt;
     if (slopeTimer <= 0.f) {
         cachedSlope = world.slopeAt3D(pos);
-        slopeTimer = 0.5f + globalRNG().range(0.0f, 0.2f); // stagger updates
+        slopeTimer = 0.5f + world.rngFor(id, RNG_SLOPE).range(0.0f, 0.2f); // stagger updates
     }
     float slope = cachedSlope;
 
@@ -106,7 +106,12 @@ float Creature::tick(float dt, World& world) {
                         float bite = 20.f * genome.carnEfficiency() * dt;  // damage per second
                         prey2.energy -= bite;
                         energy = std::min(maxEnergy, energy + bite * 0.7f);  // 70% energy transfer efficiency
-                        if (prey2.energy <= 0) prey2.alive = false;
+                        counters.bites++;
+                        if (prey2.energy <= 0 && prey2.alive) {
+                            prey2.alive = false;
+                            counters.kills++;
+                            counters.deaths[(int)DeathCause::Predation]++;
+                        }
                         needs.satisfy(Drive::Hunger, bite / 50.f);
                     }
                 } else if (genome.carnEfficiency() < genome.herbEfficiency() + 0.1f && nearestFoodDist < genome.visionRange()) {
@@ -122,6 +127,7 @@ float Creature::tick(float dt, World& world) {
                                 if (p.nutrition <= 0) p.alive = false;
                                 energy = std::min(maxEnergy, energy + eaten);
                                 needs.satisfy(Drive::Hunger, eaten / 30.f);
+                                counters.grazes++;
                                 break;
                             }
                         }
@@ -138,6 +144,7 @@ float Creature::tick(float dt, World& world) {
                     steerToward(nearestWater, spd, dt);
                     if (nearestWaterDist < 150.f) {
                         needs.satisfy(Drive::Thirst, 0.5f * dt);   // drink at 0.5 units/sec
+                        counters.drinks++;
                     }
                 }
                 break;
@@ -199,16 +206,18 @@ float Creature::tick(float dt, World& world) {
             energy     -= cost;
 
             // ── Death ─────────────────────────────────────────────────────────────────
-            if (age >= lifespan) { alive = false; std::string msg = "Death: Aging"; TracyMessageC(msg.c_str(), msg.size(), 0x004400); }
+            if (age >= lifespan) { alive = false; counters.deaths[(int)DeathCause::Aging]++; }
             else if (needs.isCritical(Drive::Health)) {
                 alive = false;
-                std::string msg;
-                if (needs.isCritical(Drive::Hunger))  msg = "Death: Lack of food";
-                else if(needs.isCritical(Drive::Thirst))  msg = "Death: Lack of water";
-                else msg = "Death: Lack of health";
-                TracyMessageC(msg.c_str(), msg.size(), 0x440000);
+                DeathCause cause = needs.isCritical(Drive::Hunger) ? DeathCause::Starvation
+                                 : needs.isCritical(Drive::Thirst) ? DeathCause::Dehydration
+                                 :                                   DeathCause::Health;
+                counters.deaths[(int)cause]++;
             }
 
             return cost;
        }
+    // Every drive case above leaves the switch with `break`, so this is the
+    // common exit; previously control fell off the end of a non-void function.
+    return 0.f;
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <vector>
 
 struct World;
+struct TickCounters;
 
 using EntityID = uint32_t;
 constexpr EntityID INVALID_ID = 0;  // Sentinel: "no entity" / "not set"
@@ -27,6 +28,22 @@ enum class BehaviorState {
     Socializing, // Approaching conspecifics
 };
 
+inline const char* behaviorName(BehaviorState b) {
+    switch (b) {
+        case BehaviorState::Idle:        return "Idle";
+        case BehaviorState::SeekFood:    return "SeekFood";
+        case BehaviorState::SeekWater:   return "SeekWater";
+        case BehaviorState::Sleeping:    return "Sleeping";
+        case BehaviorState::SeekMate:    return "SeekMate";
+        case BehaviorState::Fleeing:     return "Fleeing";
+        case BehaviorState::Hunting:     return "Hunting";
+        case BehaviorState::Mating:      return "Mating";
+        case BehaviorState::Healing:     return "Healing";
+        case BehaviorState::Socializing: return "Socializing";
+        default:                         return "??";
+    }
+}
+
 // Convenience distance function between two 3D points (XYZ Euclidean)
 inline float dist(const Vec3& a, const Vec3& b) { return (a - b).len(); }
 
@@ -82,18 +99,21 @@ struct Creature {
 
     // ── Lifecycle ─────────────────────────────────────────────────────────────
     // Called once after the genome is set to derive all genome-dependent stats.
-    void initFromGenome(const Vec3& spawnPos) {
+    // `rng` supplies the per-individual jitter (lifespan, starting drives).
+    template <typename Rng>
+    void initFromGenome(const Vec3& spawnPos, Rng& rng) {
         pos      = spawnPos;
         mass     = genome.bodySize();
         maxEnergy= 80.f + mass * 40.f;       // larger body → bigger energy tank
         energy   = maxEnergy * 0.7f;          // start at 70% so newborns still need food
-        lifespan = 600.f + globalRNG().normal(0.f, 20.f);  // add randomness to lifespan
-        needs.initFromGenome(genome);
+        lifespan = 600.f + rng.normal(0.f, 20.f);  // add randomness to lifespan
+        needs.initFromGenome(genome, rng);
     }
 
     // Main per-frame update: advances needs, runs the behaviour FSM, moves the
-    // creature, consumes energy, and checks death conditions. Returns energy spent.
-    float tick(float dt, World& world);
+    // creature, consumes energy, and checks death conditions. Interactions and
+    // deaths are tallied into `counters`. Returns energy spent.
+    float tick(float dt, World& world, TickCounters& counters);
 
     // ── Physics / steering ────────────────────────────────────────────────────
 
@@ -0,0 +1,194 @@
+#include "DataRecorder.hpp"
+#include <cmath>
+
+// ── HistoryTier ───────────────────────────────────────────────────────────────
+void HistoryTier::reset(float bucketWidth, int capacity) {
+    width = bucketWidth;
+    t.reset(capacity);
+    for (int s = 0; s < HS_COUNT; s++) {
+        lo[s].reset(capacity);
+        hi[s].reset(capacity);
+        mean[s].reset(capacity);
+    }
+    accN = 0;
+}
+
+void HistoryTier::clear() {
+    t.clear();
+    for (int s = 0; s < HS_COUNT; s++) {
+        lo[s].clear();
+        hi[s].clear();
+        mean[s].clear();
+    }
+    accN = 0;
+}
+
+void HistoryTier::add(float time, const HistoryValues& v) {
+    int64_t b = (int64_t)std::floor(time / (double)width);
+
+    // A sample past the open bucket closes it
+    if (accN > 0 && b != accBucket) {
+        t.push(openStart());
+        for (int s = 0; s < HS_COUNT; s++) {
+            lo[s].push(accLo[s]);
+            hi[s].push(accHi[s]);
+            mean[s].push(openMean(s));
+        }
+        accN = 0;
+    }
+
+    if (accN == 0) {
+        accBucket = b;
+        accLo = v;
+        accHi = v;
+        for (int s = 0; s < HS_COUNT; s++) accSum[s] = v[s];
+        accN = 1;
+        return;
+    }
+    for (int s = 0; s < HS_COUNT; s++) {
+        accLo[s]   = std::min(accLo[s], v[s]);
+        accHi[s]   = std::max(accHi[s], v[s]);
+        accSum[s] += v[s];
+    }
+    accN++;
+}
+
+// ── Queries ───────────────────────────────────────────────────────────────────
+namespace {
+
+// One resolution level as query() sees it. Level 0 is the raw samples, whose
+// envelope is the value itself; levels 1.. are the bucket tiers.
+struct Level {
+    const SeriesRing*  t    = nullptr;
+    const SeriesRing*  lo   = nullptr;
+    const SeriesRing*  hi   = nullptr;
+    const SeriesRing*  mean = nullptr;
+    const HistoryTier* tier = nullptr;   // null for raw samples
+    double             resolution = 1.0;
+
+    float start() const {
+        if (t->count() > 0) return (*t)[0];
+        if (tier && tier->hasOpen()) return tier->openStart();
+        return INFINITY;
+    }
+};
+
+// First index whose time is >= x (rings are sorted oldest first)
+int lowerBound(const SeriesRing& ts, double x) {
+    int a = 0, b = ts.count();
+    while (a < b) {
+        int m = (a + b) / 2;
+        if (ts[m] < x) a = m + 1; else b = m;
+    }
+    return a;
+}
+
+// First index whose time is > x
+int upperBound(const SeriesRing& ts, double x) {
+    int a = 0, b = ts.count();
+    while (a < b) {
+        int m = (a + b) / 2;
+        if (ts[m] <= x) a = m + 1; else b = m;
+    }
+    return a;
+}
+
+} // namespace
+
+// Bucket starts round down, so until the tiers wrap the true first sample is
+// later than any of them; raw samples reaching back to it then count as full
+// coverage.
+float DataRecorder::oldestTime() const {
+    float oldest = newestTime();
+    if (t_buf.count() > 0) oldest = std::min(oldest, t_buf[0]);
+    for (const HistoryTier& tr : tiers) {
+        if (tr.t.count() > 0) oldest = std::min(oldest, tr.t[0]);
+        else if (tr.hasOpen()) oldest = std::min(oldest, tr.openStart());
+    }
+    return std::max(oldest, firstTime);
+}
+
+void DataRecorder::query(HistorySeries s, double t0, double t1, int maxPoints,
+                         HistoryView& out) const {
+    out.t.clear();
+    out.lo.clear();
+    out.hi.clear();
+    out.mean.clear();
+    out.tier = 0;
+    out.band = false;
+    maxPoints = std::max(maxPoints, 2);
+    if (t_buf.count() == 0 || !(t1 > t0)) return;
+
+    Level levels[1 + TIER_COUNT];
+    levels[0] = { &t_buf, &raw[s], &raw[s], &raw[s], nullptr, std::max(sampleInterval, 1e-3f) };
+    for (int i = 0; i < TIER_COUNT; i++)
+        levels[i + 1] = { &tiers[i].t, &tiers[i].lo[s], &tiers[i].hi[s], &tiers[i].mean[s],
+                          &tiers[i], tiers[i].width };
+
+    // Finest level that holds data back to the left edge (or to the oldest
+    // data anywhere, if the view starts before that) and is sparse enough.
+    // Falls back to the coarsest level, decimated below.
+    double reach = std::max(t0, (double)oldestTime());
+    double right = std::min(t1, (double)newestTime());
+    int pick = TIER_COUNT;
+    for (int L = 0; L <= TIER_COUNT; L++) {
+        double start = levels[L].start();
+        if (start > reach) continue;
+        if ((right - std::max(t0, start)) / levels[L].resolution <= maxPoints) { pick = L; break; }
+    }
+    const Level& lv = levels[pick];
+    out.tier = pick;
+
+    // Visible slice plus one neighbour either side
+    const SeriesRing& ts = *lv.t;
+    int a = lowerBound(ts, t0), b = upperBound(ts, t1);
+    if (a > 0) a--;
+    if (b < ts.count()) b++;
+    int n = std::max(b - a, 0) + 1;
+    out.t.reserve(n);
+    out.lo.reserve(n);
+    out.hi.reserve(n);
+    out.mean.reserve(n);
+    for (int i = a; i < b; i++) {
+        out.t.push_back(ts[i]);
+        out.lo.push_back((*lv.lo)[i]);
+        out.hi.push_back((*lv.hi)[i]);
+        out.mean.push_back((*lv.mean)[i]);
+    }
+    // The open bucket carries the newest samples of a tier
+    if (lv.tier && lv.tier->hasOpen() && lv.tier->openStart() <= t1
+        && (ts.count() == 0 || lv.tier->openStart() > ts.back())) {
+        out.t.push_back(lv.tier->openStart());
+        out.lo.push_back(lv.tier->openLo(s));
+        out.hi.push_back(lv.tier->openHi(s));
+        out.mean.push_back(lv.tier->openMean(s));
+    }
+    out.band = pick > 0;
+
+    // Min/max decimation: merge runs of k points so every pixel column keeps
+    // its extremes and the envelope never hides a spike
+    int total = out.count();
+    if (total > maxPoints) {
+        int k = (total + maxPoints - 1) / maxPoints;
+        int w = 0;
+        for (int i = 0; i < total; i += k, w++) {
+            int    e   = std::min(i + k, total);
+            float  lo  = out.lo[i], hi = out.hi[i];
+            double sum = 0;
+            for (int j = i; j < e; j++) {
+                lo   = std::min(lo, out.lo[j]);
+                hi   = std::max(hi, out.hi[j]);
+                sum += out.mean[j];
+            }
+            out.t[w]    = out.t[i];
+            out.lo[w]   = lo;
+            out.hi[w]   = hi;
+            out.mean[w] = (float)(sum / (e - i));
+        }
+        out.t.resize(w);
+        out.lo.resize(w);
+        out.hi.resize(w);
+        out.mean.resize(w);
+        out.band = true;
+    }
+}
@@ -1,7 +1,11 @@
 #pragma once
 #include "World/World.hpp"
+#include "Sim/EntityTables.hpp"
+#include "Sim/Telemetry.hpp"
+#include "Sim/SpeciesHistory.hpp"
+#include "Sim/GeneHistograms.hpp"
+#include <array>
 #include <vector>
-#include <deque>
 #include <algorithm>
 
 // ── DataSample ────────────────────────────────────────────────────────────────
@@ -19,42 +23,172 @@ struct DataSample {
     float avgCarnEff   = 0;   // Mean carnEfficiency gene (tracks meat-eating evolution)
     float avgMutRate   = 0;   // Mean mutationRate gene (evolving evolvability indicator)
     float plantCount   = 0;   // Number of alive plant entities
+    World::EventCounters interval;   // births, deaths by cause and interactions since the previous sample
+};
+
+// ── SeriesRing ────────────────────────────────────────────────────────────────
+// Fixed-capacity ring of floats for one plotted series. push() is O(1); once
+// full, each push overwrites the oldest value. Readers index it oldest-first
+// with operator[]; DataRecorder::query() walks the rings that way to extract
+// the visible span of a series into a HistoryView for plotting.
+struct SeriesRing {
+    void reset(int capacity) { buf.assign((size_t)std::max(capacity, 1), 0.f); head = 0; n = 0; }
+    void clear()             { head = 0; n = 0; }
+
+    void push(float v) {
+        buf[head] = v;
+        head = (head + 1) % (int)buf.size();
+        if (n < (int)buf.size()) n++;
+    }
+
+    int count() const    { return n; }
+    int capacity() const { return (int)buf.size(); }
+
+    // i = 0 is the oldest value still held
+    float operator[](int i) const { return buf[(oldest() + i) % (int)buf.size()]; }
+    float back() const            { return buf[(head + (int)buf.size() - 1) % (int)buf.size()]; }
+
+private:
+    int oldest() const { return n < (int)buf.size() ? 0 : head; }
+
+    std::vector<float> buf = std::vector<float>(1, 0.f);
+    int head = 0;   // next slot to write
+    int n    = 0;   // values held (≤ capacity)
+};
+
+// Quantities kept in the history, indexable so every tier stores them alike
+enum HistorySeries : int {
+    HS_TOTAL,      // total population
+    HS_HERB,       // herbivore population
+    HS_CARN,       // carnivore population
+    HS_PLANTS,     // plant count
+    HS_SPECIES,    // active species count
+    HS_SPEED,      // average maxSpeed
+    HS_SIZE,       // average bodySize
+    HS_HERB_EFF,   // average herbEfficiency
+    HS_CARN_EFF,   // average carnEfficiency
+    HS_BIRTHS,     // births since the previous sample
+    HS_DEATHS,     // deaths since the previous sample
+    HS_KILLS,      // predator kills since the previous sample
+    HS_COUNT
+};
+
+using HistoryValues = std::array<float, HS_COUNT>;
+
+// ── HistoryTier ───────────────────────────────────────────────────────────────
+// Fixed-width time buckets summarising the raw samples. Each closed bucket
+// holds the min, max and mean of every series over its span, so a spike that
+// lasted one sample is still visible hours later. Samples are folded into the
+// open bucket as they arrive and the bucket is pushed once a sample lands past
+// its end: O(HS_COUNT) per sample, nothing is ever rescanned.
+struct HistoryTier {
+    float      width = 0.f;   // bucket span, simulation seconds
+    SeriesRing t;             // bucket start times
+    std::array<SeriesRing, HS_COUNT> lo, hi, mean;
+
+    void reset(float bucketWidth, int capacity);
+    void clear();
+    void add(float time, const HistoryValues& v);
+
+    // The open bucket – not yet in the rings, but plotted as the newest point
+    bool  hasOpen() const    { return accN > 0; }
+    float openStart() const  { return (float)(accBucket * (double)width); }
+    float openLo(int s) const   { return accLo[s]; }
+    float openHi(int s) const   { return accHi[s]; }
+    float openMean(int s) const { return (float)(accSum[s] / accN); }
+
+private:
+    int64_t       accBucket = 0;
+    int           accN      = 0;
+    HistoryValues accLo{}, accHi{};
+    std::array<double, HS_COUNT> accSum{};
+};
+
+// Points of one series extracted for drawing. lo/hi are the envelope of each
+// point's span (equal to mean for undecimated raw samples).
+struct HistoryView {
+    std::vector<float> t, lo, hi, mean;
+    int  tier = 0;        // 0 = raw samples, 1.. = DataRecorder::tiers[tier-1]
+    bool band = false;    // lo/hi differ from mean somewhere: draw the envelope
+    int  count() const { return (int)t.size(); }
 };
 
 // ── DataRecorder ──────────────────────────────────────────────────────────────
-// Samples the simulation state at a fixed rate (default 1 Hz) and maintains
-// a ring buffer of up to MAX_SAMPLES history points.
+// Samples the simulation state at a fixed rate (default 1 Hz) into one
+// SeriesRing per plotted quantity. Recording a sample is O(1) whatever the
+// history length; all rings share the same head, so index i of every series
+// belongs to the same sample and t_buf is the common X axis.
+//
+// The raw rings cover the recent past at full resolution. Behind them, three
+// bucket tiers (10 s, 1 min, 10 min) keep min/max/mean summaries reaching back
+// a day, a week and two months, at a fixed few MB in total. query() serves a
+// plot from the finest tier that covers its visible range without exceeding
+// its pixel width, so drawing costs the same at hour 1 and hour 1000.
 //
-// Pre-allocated flat std::vector buffers mirror the deque for ImPlot, which
-// requires contiguous float arrays. These are rebuilt whenever a new sample
-// is pushed (rebuildBuffers). A deque is used for history so pop_front is O(1).
+// While a telemetry stream is open, every sample is also appended to disk (see
+// Telemetry.hpp) so the complete history survives beyond the ring capacity.
 struct DataRecorder {
-    // 1 hour of 1-Hz data; older samples are discarded automatically
-    static constexpr int MAX_SAMPLES = 3600;
-
-    // Ring buffer of samples; oldest at front, newest at back
-    std::deque<DataSample> history;
-
-    // Pre-allocated contiguous arrays for ImPlot (avoids per-frame heap allocation).
-    // Each buf[i] corresponds to history[i] so they can be passed directly to
-    // ImPlot::PlotLine(name, t_buf.data(), y_buf.data(), n).
-    std::vector<float> t_buf,       // simulation time axis
-                       total_buf,   // total population
-                       herb_buf,    // herbivore population
-                       carn_buf,    // carnivore population
-                       species_buf, // active species count
-                       speed_buf,   // average maxSpeed
-                       size_buf,    // average bodySize
-                       herbEff_buf, // average herbEfficiency
-                       carnEff_buf, // average carnEfficiency
-                       plant_buf;   // plant count
+    // 10 hours of 1-Hz data by default; older samples are overwritten
+    static constexpr int DEFAULT_CAPACITY = 36000;
+
+    // Bucket widths (sim seconds) and lengths of the summary tiers
+    static constexpr int   TIER_COUNT = 3;
+    static constexpr float TIER_WIDTH[TIER_COUNT]    = { 10.f, 60.f, 600.f };
+    static constexpr int   TIER_CAPACITY[TIER_COUNT] = { 8640, 10080, 8640 };   // 24 h, 7 d, 60 d
+
+    DataRecorder() {
+        setCapacity(DEFAULT_CAPACITY);
+        for (int i = 0; i < TIER_COUNT; i++) tiers[i].reset(TIER_WIDTH[i], TIER_CAPACITY[i]);
+    }
+
+    SeriesRing t_buf;                      // simulation time axis
+    std::array<SeriesRing, HS_COUNT> raw;  // one ring per HistorySeries
+    std::array<HistoryTier, TIER_COUNT> tiers;
+    float firstTime = 0.f;                 // earliest sample since the last clearHistory()
+
+    DataSample latest;      // most recent sample, for readouts
+
+    // Per-species series, sampled at every species centroid update rather
+    // than at sampleInterval
+    SpeciesHistory speciesHistory;
+
+    // Distribution of every gene, rebuilt with each sample
+    GeneHistograms geneHist;
+
+    // Rows for the species and creature browsers, captured with each sample
+    // while enabled and sorted on a worker thread
+    EntityTables tables;
+
+    // Resize the raw series; discards their history (the tiers are kept)
+    void setCapacity(int samples) {
+        t_buf.reset(samples);
+        for (SeriesRing& r : raw) r.reset(samples);
+    }
+    int capacity() const { return t_buf.capacity(); }
+
+    // Drop every tier, e.g. after the world's clock jumped backwards
+    void clearHistory() {
+        t_buf.clear();
+        for (SeriesRing& r : raw) r.clear();
+        for (HistoryTier& tr : tiers) tr.clear();
+    }
 
     float sampleTimer    = 0.f;    // accumulator; fires when it exceeds sampleInterval
     float sampleInterval = 1.f;    // how many simulation seconds between samples
 
+    // Full-history stream on disk; closed unless startTelemetry() was called
+    TelemetryWriter      telemetry;
+    World::EventCounters lastEvents;   // world.events at the previous sample
+
+    bool startTelemetry(const std::string& path) { return telemetry.open(path); }
+    void stopTelemetry() { telemetry.close(); }
+
     // Called every frame. Accumulates dt; when the interval is reached, captures
-    // a new DataSample from the current world state and refreshes ImPlot buffers.
+    // a new DataSample from the current world state and appends it to every series.
     void tick(float dt, const World& world) {
+        speciesHistory.update(world);
+        if (tables.wantsCapture()) tables.capture(world);
+
         sampleTimer += dt;
         if (sampleTimer < sampleInterval) return;
         sampleTimer = 0.f;
@@ -87,58 +221,67 @@ struct DataRecorder {
         // Count only species that have living members
         s.speciesCount = (int)std::count_if(world.species.begin(), world.species.end(),
                                             [](const SpeciesInfo& sp){ return sp.count > 0; });
+        s.interval = world.events.since(lastEvents);
+        lastEvents = world.events;
 
-        history.push_back(s);
-        if ((int)history.size() > MAX_SAMPLES) history.pop_front();  // discard oldest
-
-        rebuildBuffers();  // keep ImPlot arrays in sync
-    }
+        latest = s;
+        geneHist.compute(world);
+        tables.capture(world);
+        HistoryValues v;
+        v[HS_TOTAL]    = (float)s.totalPop;
+        v[HS_HERB]     = (float)s.herbPop;
+        v[HS_CARN]     = (float)s.carnPop;
+        v[HS_PLANTS]   = s.plantCount;
+        v[HS_SPECIES]  = (float)s.speciesCount;
+        v[HS_SPEED]    = s.avgSpeed;
+        v[HS_SIZE]     = s.avgSize;
+        v[HS_HERB_EFF] = s.avgHerbEff;
+        v[HS_CARN_EFF] = s.avgCarnEff;
+        v[HS_BIRTHS]   = (float)s.interval.births;
+        v[HS_DEATHS]   = (float)s.interval.deaths;
+        v[HS_KILLS]    = (float)s.interval.kills;
+        record(s.time, v);
 
-    // Synchronise the flat ImPlot buffers with the current deque contents.
-    // Must be called after any insertion or removal from `history`.
-    void rebuildBuffers() {
-        int n = (int)history.size();
-        auto resize = [&](std::vector<float>& v){ v.resize(n); };
-        resize(t_buf);       resize(total_buf);
-        resize(herb_buf);    resize(carn_buf);
-        resize(species_buf); resize(speed_buf);
-        resize(size_buf);    resize(herbEff_buf);
-        resize(carnEff_buf); resize(plant_buf);
-
-        for (int i = 0; i < n; i++) {
-            const auto& s  = history[i];
-            t_buf[i]       = s.time;
-            total_buf[i]   = (float)s.totalPop;
-            herb_buf[i]    = (float)s.herbPop;
-            carn_buf[i]    = (float)s.carnPop;
-            species_buf[i] = (float)s.speciesCount;
-            speed_buf[i]   = s.avgSpeed;
-            size_buf[i]    = s.avgSize;
-            herbEff_buf[i] = s.avgHerbEff;
-            carnEff_buf[i] = s.avgCarnEff;
-            plant_buf[i]   = s.plantCount;
+        if (telemetry.isOpen()) {
+            TelemetryRecord r;
+            r.time         = s.time;
+            r.totalPop     = (uint32_t)s.totalPop;
+            r.herbPop      = (uint32_t)s.herbPop;
+            r.carnPop      = (uint32_t)s.carnPop;
+            r.speciesCount = (uint32_t)s.speciesCount;
+            r.avgSpeed     = s.avgSpeed;
+            r.avgSize      = s.avgSize;
+            r.avgHerbEff   = s.avgHerbEff;
+            r.avgCarnEff   = s.avgCarnEff;
+            r.avgMutRate   = s.avgMutRate;
+            r.plantCount   = (uint32_t)s.plantCount;
+            r.births       = (uint32_t)s.interval.births;
+            r.deaths       = (uint32_t)s.interval.deaths;
+            r.speciations  = (uint32_t)s.interval.speciations;
+            telemetry.push(r);
         }
     }
 
-    int size() const { return (int)history.size(); }
-
-    // Build a histogram of one gene's raw values across the current population.
-    // outX[i] = normalised gene value for bin i (0 to 1)
-    // outY[i] = count of creatures in that bin
-    // The histogram uses equal-width bins over [0,1], the gene's raw range.
-    void geneHistogram(const World& world, GeneIdx gene,
-                       int bins, std::vector<float>& outX,
-                       std::vector<float>& outY) const {
-        outX.assign(bins, 0.f);
-        outY.assign(bins, 0.f);
-        for (const auto& c : world.creatures) {
-            if (!c.alive) continue;
-            // Map raw gene value [0,1] → bin index [0, bins-1]
-            int b = (int)(c.genome.raw[gene] * (bins - 1));
-            outY[b]++;
-        }
-        // Fill X axis with the centre value of each bin
-        for (int i = 0; i < bins; i++)
-            outX[i] = (float)i / (bins - 1);
+    // Append one sample to the raw rings and fold it into every tier. A time
+    // earlier than the last sample (a load or rewind) restarts the history,
+    // keeping every tier sorted by time.
+    void record(float time, const HistoryValues& v) {
+        if (t_buf.count() > 0 && time < t_buf.back()) clearHistory();
+        if (t_buf.count() == 0 && !tiers[0].hasOpen()) firstTime = time;
+        t_buf.push(time);
+        for (int i = 0; i < HS_COUNT; i++) raw[i].push(v[i]);
+        for (HistoryTier& tr : tiers) tr.add(time, v);
     }
-};
\ No newline at end of file
+
+    // Fill `out` with series `s` over [t0, t1] using at most ~maxPoints points:
+    // the finest tier that reaches back to t0 and is sparse enough, min/max
+    // decimated further if even the coarsest tier is too dense. Includes one
+    // point either side of the range so lines run to the plot edges.
+    void query(HistorySeries s, double t0, double t1, int maxPoints, HistoryView& out) const;
+
+    // Time span held by any tier
+    float oldestTime() const;
+    float newestTime() const { return t_buf.count() ? t_buf.back() : 0.f; }
+
+    int size() const { return t_buf.count(); }
+};
@@ -0,0 +1,251 @@
+#include "EntityTables.hpp"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+namespace {
+
+constexpr int BEHAVIOR_COUNT = (int)BehaviorState::Socializing + 1;
+static_assert(BEHAVIOR_COUNT <= 16, "creatureKey keeps the behaviour in 4 bits");
+
+char foldCase(char c) { return c >= 'A' && c <= 'Z' ? (char)(c + ('a' - 'A')) : c; }
+
+// `needle` is already lower case
+bool containsNoCase(const char* hay, size_t n, const std::string& needle) {
+    size_t m = needle.size();
+    for (size_t i = 0; i + m <= n; i++) {
+        size_t k = 0;
+        while (k < m && foldCase(hay[i + k]) == needle[k]) k++;
+        if (k == m) return true;
+    }
+    return false;
+}
+
+// Row indices 0..n-1 ordered by key(row), ties broken by row
+template <typename Key>
+void sortBy(std::vector<uint32_t>& order, size_t n, Key key) {
+    order.resize(n);
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        const auto& ka = key(a);
+        const auto& kb = key(b);
+        if (ka < kb) return true;
+        if (kb < ka) return false;
+        return a < b;
+    });
+}
+
+} // namespace
+
+// ── EntityTables ──────────────────────────────────────────────────────────────
+EntityTables::~EntityTables() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        quit = true;
+    }
+    cv.notify_one();
+    if (worker.joinable()) worker.join();
+}
+
+void EntityTables::setEnabled(bool on) {
+    if (on && !active) primed = false;
+    active = on;
+}
+
+// Called from the thread that ticks the world, which is also the one that
+// polls; only the sorting happens elsewhere.
+void EntityTables::capture(const World& world) {
+    if (!active) return;
+    std::unique_ptr<TableSnapshot> s;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (job || working) return;
+        if (!pool.empty()) { s = std::move(pool.back()); pool.pop_back(); }
+    }
+    if (!s) s = std::make_unique<TableSnapshot>();
+    if (!worker.joinable()) worker = std::thread([this]{ workerLoop(); });
+    primed = true;
+
+    s->time    = world.simTime;
+    s->version = ++captures;
+
+    // Counts include members classified since the last centroid update, so
+    // species formed since then are listed too
+    s->species.clear();
+    s->speciesByID.assign(world.nextSpeciesID, -1);
+    for (const SpeciesInfo& sp : world.species) {
+        if (sp.count <= 0) continue;
+        if (sp.id < s->speciesByID.size()) s->speciesByID[sp.id] = (int32_t)s->species.size();
+        SpeciesRow& r = s->species.emplace_back();
+        r.id      = sp.id;
+        r.count   = sp.count;
+        r.allTime = sp.allTime;
+        r.speed   = sp.centroid.maxSpeed();
+        r.size    = sp.centroid.bodySize();
+        r.herb    = sp.centroid.herbEfficiency();
+        r.carn    = sp.centroid.carnEfficiency();
+        r.color[0] = sp.color[0];
+        r.color[1] = sp.color[1];
+        r.color[2] = sp.color[2];
+        r.name    = sp.name;
+    }
+
+    s->creatures.clear();
+    s->creatureKey.clear();
+    s->creatures.reserve(world.creatures.size());
+    s->creatureKey.reserve(world.creatures.size());
+    for (const Creature& c : world.creatures) {
+        if (!c.alive) continue;
+        int32_t sr = c.speciesID < s->speciesByID.size() ? s->speciesByID[c.speciesID] : -1;
+        s->creatureKey.push_back((uint32_t)(sr + 1) << 4 | (uint32_t)c.behavior);
+        CreatureRow& r = s->creatures.emplace_back();
+        r.id         = c.id;
+        r.speciesID  = c.speciesID;
+        r.generation = c.generation;
+        r.age        = c.age;
+        r.energy     = c.maxEnergy > 0.f ? c.energy / c.maxEnergy : 0.f;
+        r.health     = 1.f - c.needs.urgency[(int)Drive::Health];
+        r.speed      = c.genome.maxSpeed();
+        r.size       = c.genome.bodySize();
+        r.behavior   = c.behavior;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        job = std::move(s);
+    }
+    cv.notify_one();
+}
+
+bool EntityTables::poll() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (!done) return false;
+    if (shown) pool.push_back(std::move(shown));
+    shown = std::move(done);
+    return true;
+}
+
+void EntityTables::workerLoop() {
+    for (;;) {
+        std::unique_ptr<TableSnapshot> s;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this]{ return quit || job; });
+            if (quit) return;
+            s = std::move(job);
+            working = true;
+        }
+        sortSnapshot(*s);
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (done) pool.push_back(std::move(done));   // never polled; superseded
+            done    = std::move(s);
+            working = false;
+        }
+    }
+}
+
+void EntityTables::sortSnapshot(TableSnapshot& s) {
+    const std::vector<SpeciesRow>& sp = s.species;
+    size_t ns = sp.size();
+    sortBy(s.speciesOrder[SPC_NAME],    ns, [&](uint32_t i) -> const std::string& { return sp[i].name; });
+    sortBy(s.speciesOrder[SPC_MEMBERS], ns, [&](uint32_t i) { return sp[i].count; });
+    sortBy(s.speciesOrder[SPC_ALLTIME], ns, [&](uint32_t i) { return sp[i].allTime; });
+    sortBy(s.speciesOrder[SPC_SPEED],   ns, [&](uint32_t i) { return sp[i].speed; });
+    sortBy(s.speciesOrder[SPC_SIZE],    ns, [&](uint32_t i) { return sp[i].size; });
+    sortBy(s.speciesOrder[SPC_DIET],    ns, [&](uint32_t i) { return sp[i].carn - sp[i].herb; });
+
+    const std::vector<CreatureRow>& cr = s.creatures;
+    size_t nc = cr.size();
+    sortBy(s.creatureOrder[CRC_ID],         nc, [&](uint32_t i) { return cr[i].id; });
+    sortBy(s.creatureOrder[CRC_SPECIES],    nc, [&](uint32_t i) { return cr[i].speciesID; });
+    sortBy(s.creatureOrder[CRC_GENERATION], nc, [&](uint32_t i) { return cr[i].generation; });
+    sortBy(s.creatureOrder[CRC_AGE],        nc, [&](uint32_t i) { return cr[i].age; });
+    sortBy(s.creatureOrder[CRC_ENERGY],     nc, [&](uint32_t i) { return cr[i].energy; });
+    sortBy(s.creatureOrder[CRC_HEALTH],     nc, [&](uint32_t i) { return cr[i].health; });
+    sortBy(s.creatureOrder[CRC_SPEED],      nc, [&](uint32_t i) { return cr[i].speed; });
+    sortBy(s.creatureOrder[CRC_SIZE],       nc, [&](uint32_t i) { return cr[i].size; });
+    sortBy(s.creatureOrder[CRC_STATE],      nc, [&](uint32_t i) { return (int)cr[i].behavior; });
+}
+
+// ── TableView ─────────────────────────────────────────────────────────────────
+// Decide what a new pass must do, if anything; true when one was started.
+// Any change during an unfinished pass restarts from scratch, since the
+// match flags are only complete once a pass has visited every row.
+bool TableView::begin(const TableSnapshot& s, const std::vector<uint32_t>* ord, size_t nrows) {
+    needle.resize(filter.size());
+    std::transform(filter.begin(), filter.end(), needle.begin(), foldCase);
+    filtered = !needle.empty();
+
+    bool newData  = s.version != builtVersion || match.size() != nrows;
+    bool newOrder = ord != order;
+    bool complete = source && pos >= source->size();
+    order = ord;
+    if (!filtered) {
+        builtVersion = s.version;
+        builtFilter.clear();
+        source = nullptr;
+        return false;
+    }
+    if (!newData && !newOrder && needle == builtFilter) return false;
+
+    if (newData || !complete || builtFilter.empty())             mode = RETEST_ALL;
+    else if (needle == builtFilter)                              mode = RETEST_NONE;     // re-sorted
+    else if (!newOrder && needle.find(builtFilter) != std::string::npos) mode = RETEST_MATCHED;   // narrowed
+    else                                                         mode = RETEST_ALL;
+
+    if (mode == RETEST_MATCHED) {
+        prevRows.swap(rows);
+        source = &prevRows;
+    } else {
+        source = order;
+    }
+    if (mode == RETEST_ALL) match.assign(nrows, 0);
+    rows.clear();
+    pos          = 0;
+    builtVersion = s.version;
+    builtFilter  = needle;
+    return true;
+}
+
+// Visit the next slice of the source in display order. Visited rows that
+// match are appended, so the visible list is always a correct prefix.
+template <typename Test>
+void TableView::step(Test test) {
+    if (!filtered || !source) return;
+    size_t end = std::min(source->size(), pos + ROWS_PER_UPDATE);
+    for (; pos < end; pos++) {
+        uint32_t r = (*source)[pos];
+        bool m = mode == RETEST_NONE ? match[r] != 0 : (match[r] = test(r)) != 0;
+        if (m) rows.push_back(r);
+    }
+}
+
+void TableView::updateSpecies(const TableSnapshot& s) {
+    column = std::clamp(column, 0, SPC_COLUMNS - 1);
+    begin(s, &s.speciesOrder[column], s.species.size());
+    step([&](uint32_t r) {
+        const std::string& name = s.species[r].name;
+        return containsNoCase(name.data(), name.size(), needle);
+    });
+}
+
+void TableView::updateCreatures(const TableSnapshot& s) {
+    column = std::clamp(column, 0, CRC_COLUMNS - 1);
+    if (begin(s, &s.creatureOrder[column], s.creatures.size()) && mode != RETEST_NONE) {
+        // Per species and per behaviour once, not per creature; slot 0 of
+        // speciesHit stands for "no live species"
+        size_t ns = s.species.size();
+        if (mode == RETEST_ALL) speciesHit.assign(ns + 1, 1);
+        speciesHit[0] = 0;
+        for (size_t i = 0; i < ns; i++)
+            if (speciesHit[i + 1])
+                speciesHit[i + 1] = containsNoCase(s.species[i].name.data(), s.species[i].name.size(), needle);
+        for (int b = 0; b < 16; b++) {
+            const char* name = b < BEHAVIOR_COUNT ? behaviorName((BehaviorState)b) : "";
+            stateHit[b] = containsNoCase(name, std::strlen(name), needle);
+        }
+    }
+    const uint32_t* key = s.creatureKey.data();
+    step([&](uint32_t r) { return (uint8_t)(speciesHit[key[r] >> 4] | stateHit[key[r] & 15]); });
+}
@@ -0,0 +1,174 @@
+#pragma once
+#include "World/World.hpp"
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ── Browser rows ──────────────────────────────────────────────────────────────
+// Flat copies of what the Species and Creatures tables display, taken at
+// sample time so the panels never walk the live world.
+struct SpeciesRow {
+    uint32_t    id      = 0;
+    int         count   = 0;
+    int         allTime = 0;
+    float       speed   = 0.f;
+    float       size    = 0.f;
+    float       herb    = 0.f;   // centroid diet efficiencies
+    float       carn    = 0.f;
+    float       color[3] = {};
+    std::string name;
+
+    const char* diet() const {
+        bool h = herb > 0.5f, c = carn > 0.5f;
+        return h && c ? "Omni" : h ? "Herb" : "Carn";
+    }
+};
+
+struct CreatureRow {
+    EntityID      id         = INVALID_ID;
+    uint32_t      speciesID  = 0;
+    uint32_t      generation = 0;
+    float         age        = 0.f;
+    float         energy     = 0.f;   // fraction of maxEnergy
+    float         health     = 0.f;   // 1 - health drive urgency
+    float         speed      = 0.f;
+    float         size       = 0.f;
+    BehaviorState behavior   = BehaviorState::Idle;
+};
+
+enum SpeciesColumn {
+    SPC_NAME, SPC_MEMBERS, SPC_ALLTIME, SPC_SPEED, SPC_SIZE, SPC_DIET,
+    SPC_COLUMNS
+};
+
+enum CreatureColumn {
+    CRC_ID, CRC_SPECIES, CRC_GENERATION, CRC_AGE, CRC_ENERGY, CRC_HEALTH,
+    CRC_SPEED, CRC_SIZE, CRC_STATE,
+    CRC_COLUMNS
+};
+
+// ── TableSnapshot ─────────────────────────────────────────────────────────────
+// One capture plus, per column, the row indices in ascending key order (ties
+// by row), so switching the sort column or direction costs nothing.
+struct TableSnapshot {
+    float    time    = 0.f;
+    uint64_t version = 0;                      // bumps with every sorted capture
+
+    std::vector<SpeciesRow>  species;          // species with living members
+    std::vector<CreatureRow> creatures;        // living creatures
+    std::vector<int32_t>     speciesByID;      // species ID → row in `species`, -1 if none
+    std::vector<uint32_t>    creatureKey;      // per creature: species row + 1 << 4 | behaviour, for filtering
+
+    std::array<std::vector<uint32_t>, SPC_COLUMNS> speciesOrder;
+    std::array<std::vector<uint32_t>, CRC_COLUMNS> creatureOrder;
+
+    const SpeciesRow* speciesOf(const CreatureRow& c) const {
+        int32_t r = c.speciesID < speciesByID.size() ? speciesByID[c.speciesID] : -1;
+        return r >= 0 ? &species[r] : nullptr;
+    }
+};
+
+// ── EntityTables ──────────────────────────────────────────────────────────────
+// Captures rows on the simulation thread (O(live) copies, no sorting) and
+// hands them to a worker thread that builds every column order. The UI adopts
+// finished snapshots with poll(), so a panel's per-frame cost is only the
+// rows it actually draws. A capture is skipped while the worker is still
+// sorting the previous one. The worker starts on the first capture, so a
+// recorder that never enables the tables never spawns it.
+struct EntityTables {
+    EntityTables() = default;
+    ~EntityTables();
+    EntityTables(const EntityTables&)            = delete;
+    EntityTables& operator=(const EntityTables&) = delete;
+
+    // Browsers open; while false, capture() is never wanted
+    void setEnabled(bool on);
+    bool enabled() const { return active; }
+
+    // True when enabled but nothing has been captured since: a newly opened
+    // panel shouldn't wait for the next sample
+    bool wantsCapture() const { return active && !primed; }
+
+    void capture(const World& world);
+
+    // Adopt the newest sorted snapshot; true if it changed
+    bool poll();
+    const TableSnapshot* current() const { return shown.get(); }
+
+private:
+    void workerLoop();
+    static void sortSnapshot(TableSnapshot& s);
+
+    bool     active   = false;
+    bool     primed   = false;
+    uint64_t captures = 0;
+
+    std::unique_ptr<TableSnapshot> shown;                  // UI thread
+
+    std::thread                                 worker;
+    std::mutex                                  mtx;
+    std::condition_variable                     cv;
+    std::unique_ptr<TableSnapshot>              job;        // guarded: captured, awaiting sort
+    std::unique_ptr<TableSnapshot>              done;       // guarded: sorted, awaiting poll
+    std::vector<std::unique_ptr<TableSnapshot>> pool;       // guarded: buffers for reuse
+    bool                                        working = false;   // guarded
+    bool                                        quit    = false;   // guarded
+};
+
+// ── TableView ─────────────────────────────────────────────────────────────────
+// The visible rows of one browser table: a snapshot column order, optionally
+// reversed, restricted to rows whose text contains the filter.
+//
+// Filtering is incremental in two ways. A pass walks the column order and
+// tests at most ROWS_PER_UPDATE rows per call, so typing into the filter of a
+// 100k-row table never stalls a frame; the rows found so far are already in
+// display order and are shown while the pass continues. And a pass only tests
+// what it must: a match flag per row survives re-sorting (which just re-walks
+// the new order), and narrowing the filter re-tests only the rows that matched.
+// Creatures match on their species name or behaviour, tested once per species
+// and per behaviour rather than per creature.
+struct TableView {
+    static constexpr size_t ROWS_PER_UPDATE = 16384;
+
+    int         column    = 0;
+    bool        ascending = true;
+    std::string filter;
+
+    // Call once per frame before reading rows
+    void updateSpecies  (const TableSnapshot& s);
+    void updateCreatures(const TableSnapshot& s);
+
+    bool   filtering() const { return filtered && source && pos < source->size(); }
+    size_t size() const { return filtered ? rows.size() : order ? order->size() : 0; }
+
+    // Row index (into the snapshot's species or creatures) of the i-th visible row
+    uint32_t row(size_t i) const {
+        size_t k = ascending ? i : size() - 1 - i;
+        return filtered ? rows[k] : (*order)[k];
+    }
+
+private:
+    enum Retest { RETEST_NONE, RETEST_MATCHED, RETEST_ALL };
+
+    const std::vector<uint32_t>* order  = nullptr;   // current column order
+    const std::vector<uint32_t>* source = nullptr;   // what the pass walks: order or prevRows
+    std::vector<uint32_t> rows;         // matches found so far, ascending
+    std::vector<uint32_t> prevRows;     // previous matches, when narrowing
+    std::vector<uint8_t>  match;        // per snapshot row
+    std::vector<uint8_t>  speciesHit;   // per species row + 1, creature tables only
+    uint8_t               stateHit[16] = {};
+    std::string           needle;       // lower-case filter
+    Retest                mode = RETEST_ALL;
+    size_t                pos  = 0;     // next source index to visit
+    bool                  filtered     = false;
+    uint64_t              builtVersion = 0;
+    std::string           builtFilter;  // needle of the current pass
+
+    bool begin(const TableSnapshot& s, const std::vector<uint32_t>* ord, size_t nrows);
+    template <typename Test> void step(Test test);
+};
@@ -0,0 +1,55 @@
+#include "GeneHistograms.hpp"
+#include <algorithm>
+
+void GeneHistograms::compute(const World& world) {
+    bins  = std::clamp(bins, 2, 256);
+    nbins = bins;
+    const size_t block = (size_t)GENOME_SIZE * nbins;
+    time       = world.simTime;
+    population = 0;
+    counts.assign(block, 0.f);
+
+    centres.resize(nbins);
+    for (int b = 0; b < nbins; b++) centres[b] = (b + 0.5f) / nbins;
+
+    // One row per living species, in ID order so lookups can bisect
+    speciesIDs.clear();
+    if (perSpecies) {
+        for (uint32_t si : world.liveSpecies)
+            if (si < world.species.size()) speciesIDs.push_back(world.species[si].id);
+        std::sort(speciesIDs.begin(), speciesIDs.end());
+        rowOf.assign(world.nextSpeciesID, -1);
+        for (size_t r = 0; r < speciesIDs.size(); r++)
+            if (speciesIDs[r] < rowOf.size()) rowOf[speciesIDs[r]] = (int32_t)r;
+    }
+    speciesCounts.assign(speciesIDs.size() * block, 0.f);
+
+    // Bin offsets of every gene, computed together: gene g's counters start at
+    // g * bins, so idx[g] indexes the flat block directly
+    const float scale = (float)nbins;
+    const int   last  = nbins - 1;
+    int idx[GENOME_SIZE];
+    for (const auto& c : world.creatures) {
+        if (!c.alive) continue;
+        population++;
+        const float* raw = c.genome.raw.data();
+        for (int g = 0; g < GENOME_SIZE; g++) {
+            int b  = (int)(raw[g] * scale);
+            b      = b < 0 ? 0 : (b > last ? last : b);
+            idx[g] = g * nbins + b;
+        }
+        for (int g = 0; g < GENOME_SIZE; g++) counts[idx[g]] += 1.f;
+
+        if (!speciesIDs.empty() && c.speciesID < rowOf.size() && rowOf[c.speciesID] >= 0) {
+            float* sp = &speciesCounts[(size_t)rowOf[c.speciesID] * block];
+            for (int g = 0; g < GENOME_SIZE; g++) sp[idx[g]] += 1.f;
+        }
+    }
+}
+
+const float* GeneHistograms::gene(int g, uint32_t speciesID) const {
+    auto it = std::lower_bound(speciesIDs.begin(), speciesIDs.end(), speciesID);
+    if (it == speciesIDs.end() || *it != speciesID) return nullptr;
+    size_t row = (size_t)(it - speciesIDs.begin());
+    return &speciesCounts[(row * GENOME_SIZE + g) * nbins];
+}
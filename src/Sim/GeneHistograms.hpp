@@ -0,0 +1,45 @@
+#pragma once
+#include "World/World.hpp"
+#include <cstdint>
+#include <vector>
+
+// ── GeneHistograms ────────────────────────────────────────────────────────────
+// Distribution of every gene across the living population, built in one pass
+// at sample time and cached, so gene charts cost nothing per frame however
+// many of them are on screen.
+//
+// Each creature's 27 raw genes sit contiguously in its Genome, so the pass
+// converts all of them to bin indices in one fixed-length loop the compiler
+// vectorises, then bumps one counter per gene. With `perSpecies` set the same
+// pass also fills a block per species in World::liveSpecies (as of the last
+// centroid update; members of species formed since then count only globally).
+//
+// Bins split [0, 1] into `bins` equal widths; a raw value of exactly 1 falls in
+// the last bin. Counts are stored as float so they plot without conversion.
+struct GeneHistograms {
+    // Settings, applied by the next compute()
+    int   bins       = 20;
+    bool  perSpecies = false;
+
+    float time       = 0.f;   // simTime of the last compute()
+    int   population = 0;     // creatures counted
+
+    void compute(const World& world);
+
+    // binCount() counts for gene g, over everyone or over one species (null
+    // if that species had no members or perSpecies was off)
+    const float* gene(int g) const { return counts.empty() ? nullptr : &counts[(size_t)g * nbins]; }
+    const float* gene(int g, uint32_t speciesID) const;
+
+    int                          binCount() const   { return nbins; }
+    const std::vector<float>&    binCentres() const { return centres; }
+    const std::vector<uint32_t>& species() const    { return speciesIDs; }   // ascending IDs with a block
+
+private:
+    int                   nbins = 0;       // bins at the last compute()
+    std::vector<float>    counts;          // [gene][bin]
+    std::vector<float>    centres;         // [bin]
+    std::vector<uint32_t> speciesIDs;      // [row]
+    std::vector<float>    speciesCounts;   // [row][gene][bin]
+    std::vector<int32_t>  rowOf;           // species ID → row, scratch
+};
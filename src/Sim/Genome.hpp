@@ -65,18 +65,38 @@ enum GeneIdx : int {
     GENOME_SIZE             // Sentinel – always last; equals the total number of genes
 };
 
+// Short identifier for each gene (UI labels, CSV column names)
+inline const char* geneName(int g) {
+    static const char* names[GENOME_SIZE] = {
+        "BodySize", "MaxSpeed", "MaxSlope", "VisionRange", "VisionFOV",
+        "HerbEff", "CarnEff",
+        "HungerRate", "ThirstRate", "SleepRate", "LibidoRate", "FearSens",
+        "SocialRate", "TerritRate",
+        "DesireHealth", "DesireHunger", "DesireThirst", "DesireSleep",
+        "DesireLibido", "DesireFear", "DesireSocial",
+        "GestTime", "LitterBias",
+        "MutRate", "MutStd",
+        "Hue", "Pattern",
+    };
+    return (g >= 0 && g < GENOME_SIZE) ? names[g] : "??";
+}
+
 // ── Genome ────────────────────────────────────────────────────────────────────
 struct Genome {
     // Raw gene values, all in [0, 1]. Index with GeneIdx enum.
     std::array<float, GENOME_SIZE> raw{};
 
+    // Vision gene ranges, also used to label gene bins (World_Costs.cpp)
+    static constexpr float VISION_RANGE_MIN = 200.f, VISION_RANGE_MAX = 5000.f;
+    static constexpr float VISION_FOV_MIN   = 30.f,  VISION_FOV_MAX   = 340.f;
+
     // ── Accessors (raw gene → biological value) ───────────────────────────────
     // Each accessor applies a linear map:  biological = lo + raw * (hi - lo)
     float bodySize()        const { return map(GENE_BODY_SIZE,        50.f,  300.f); }
     float maxSpeed()        const { return map(GENE_MAX_SPEED,        50.f, 1200.f); }
-    float visionRange()     const { return map(GENE_VISION_RANGE,    200.f, 5000.f); }
+    float visionRange()     const { return map(GENE_VISION_RANGE,    VISION_RANGE_MIN, VISION_RANGE_MAX); }
     float maxSlope()        const { return map(GENE_MAX_SLOPE,       5.0f, 65.0f); }
-    float visionFOV()       const { return map(GENE_VISION_FOV,     30.0f,340.0f); }
+    float visionFOV()       const { return map(GENE_VISION_FOV,      VISION_FOV_MIN, VISION_FOV_MAX); }
 
     // Diet efficiencies are already in [0,1] so no remapping needed
     float herbEfficiency()  const { return raw[GENE_HERB_EFFICIENCY]; }
@@ -117,7 +137,8 @@ struct Genome {
     // Uniform crossover: for each gene independently, pick it from parent A or B
     // with equal probability. This produces a child with a random mix of both
     // parents' traits and avoids linkage disequilibrium effects.
-    static Genome crossover(const Genome& a, const Genome& b, RNG& rng) {
+    template <typename Rng>
+    static Genome crossover(const Genome& a, const Genome& b, Rng& rng) {
         Genome child;
         for (int i = 0; i < GENOME_SIZE; i++)
             child.raw[i] = rng.chance(0.5f) ? a.raw[i] : b.raw[i];
@@ -127,7 +148,8 @@ struct Genome {
     // Per-gene Gaussian mutation. Each gene mutates independently with
     // probability = mutationRate(). The step size is drawn from N(0, mutationStd).
     // Clamping to [0,1] keeps all genes in the valid normalised range.
-    void mutate(RNG& rng) {
+    template <typename Rng>
+    void mutate(Rng& rng) {
         float rate = mutationRate();
         float std  = mutationStd();
         for (int i = 0; i < GENOME_SIZE; i++) {
@@ -156,7 +178,8 @@ struct Genome {
     // Most genes are uniformly random; diet genes are force-set after the fact
     // so the creature will actually eat plants. Latent social/territorial drives
     // start low so they don't dominate behaviour from generation 0.
-    static Genome randomHerbivore(RNG& rng) {
+    template <typename Rng>
+    static Genome randomHerbivore(Rng& rng) {
         Genome g;
         for (auto& v : g.raw) v = rng.uniform();
         g.raw[GENE_HERB_EFFICIENCY] = rng.range(0.6f, 1.0f);  // good at plants
@@ -175,7 +198,8 @@ struct Genome {
         return g;
     }
 
-    static Genome randomCarnivore(RNG& rng) {
+    template <typename Rng>
+    static Genome randomCarnivore(Rng& rng) {
         Genome g;
         for (auto& v : g.raw) v = rng.uniform();
         g.raw[GENE_HERB_EFFICIENCY] = rng.range(0.0f, 0.3f);  // bad at plants
@@ -47,7 +47,8 @@ struct Needs {
 
     // Initialise crave rates from genome genes; also randomises starting
     // drive levels so creatures aren't all perfectly fed at spawn.
-    void initFromGenome(const Genome& g) {
+    template <typename Rng>
+    void initFromGenome(const Genome& g, Rng& rng) {
         craveRate[(int)Drive::Hunger] = g.hungerRate();
         craveRate[(int)Drive::Thirst] = g.thirstRate();
         craveRate[(int)Drive::Sleep]  = g.sleepRate();
@@ -65,7 +66,6 @@ struct Needs {
         desireMult[(int)Drive::Social] = g.desireSocial();
 
         // Stagger starting levels so not all creatures share the same hunger spike
-        RNG& rng = globalRNG();
         for (int i = 0; i < DRIVE_COUNT; i++)
             urgency[i] = (i == (int)Drive::Fear || i == (int)Drive::Health) ? 0.f : rng.range(0.1f, 0.5f);
     }
@@ -0,0 +1,190 @@
+#include "SpeciesHistory.hpp"
+#include <algorithm>
+
+// ── SpeciesTrack ──────────────────────────────────────────────────────────────
+void SpeciesTrack::add(float time, int count, int allTime, const Genome* centroid, int capacity) {
+    int births  = std::max(allTime - prevAllTime, 0);
+    int deaths  = std::max(prevCount + births - count, 0);
+    prevCount   = count;
+    prevAllTime = allTime;
+    lastSeen    = time;
+    peak        = std::max(peak, (float)count);
+
+    pendN++;
+    pendTime    = time;
+    pendPop    += count;
+    pendBirths += (uint32_t)births;
+    pendDeaths += (uint32_t)deaths;
+    if (centroid) {
+        pendGeneN++;
+        for (int g = 0; g < GENOME_SIZE; g++) pendGenes[g] += centroid->raw[g];
+    }
+    if (pendN >= stride) flush(capacity);
+}
+
+void SpeciesTrack::flush(int capacity) {
+    if (pendN == 0) return;
+    SpeciesSample s;
+    s.time       = pendTime;
+    s.population = (float)(pendPop / pendN);
+    s.births     = pendBirths;
+    s.deaths     = pendDeaths;
+    if (pendGeneN > 0) {
+        for (int g = 0; g < GENOME_SIZE; g++) {
+            float v = std::clamp(pendGenes[g] / pendGeneN, 0.f, 1.f);
+            s.genes[g] = (uint16_t)(v * 65535.f + 0.5f);
+        }
+    } else if (!samples.empty()) {
+        s.genes = samples.back().genes;   // extinction: keep the last known centroid
+    }
+    samples.push_back(s);
+
+    pendN = pendGeneN = 0;
+    pendPop = 0;
+    pendBirths = pendDeaths = 0;
+    pendGenes.fill(0.f);
+
+    if ((int)samples.size() >= capacity) thin();
+}
+
+// Merge neighbouring pairs: population and genes average, events add up
+void SpeciesTrack::thin() {
+    size_t n = samples.size(), w = 0;
+    for (size_t i = 0; i + 1 < n; i += 2, w++) {
+        const SpeciesSample& a = samples[i];
+        const SpeciesSample& b = samples[i + 1];
+        SpeciesSample m;
+        m.time       = b.time;
+        m.population = 0.5f * (a.population + b.population);
+        m.births     = a.births + b.births;
+        m.deaths     = a.deaths + b.deaths;
+        for (int g = 0; g < GENOME_SIZE; g++)
+            m.genes[g] = (uint16_t)(((uint32_t)a.genes[g] + b.genes[g] + 1) / 2);
+        samples[w] = m;
+    }
+    if (n & 1) samples[w++] = samples[n - 1];
+    samples.resize(w);
+    stride *= 2;
+}
+
+const SpeciesSample* SpeciesTrack::sampleAt(float t) const {
+    if (samples.empty() || t < firstSeen) return nullptr;
+    auto it = std::lower_bound(samples.begin(), samples.end(), t,
+                               [](const SpeciesSample& s, float v) { return s.time < v; });
+    if (it == samples.end()) return extinct ? nullptr : &samples.back();
+    return &*it;
+}
+
+// ── SpeciesHistory ────────────────────────────────────────────────────────────
+void SpeciesHistory::update(const World& world) {
+    if (world.speciesUpdates == seenUpdate) return;
+    seenUpdate = world.speciesUpdates;
+
+    // A load or rewind to an earlier time starts a new timeline
+    float now = world.simTime;
+    if (now < lastTime) clear();
+    lastTime = now;
+    updates++;
+
+    // One sample per live species; new species get a track
+    nextLive.clear();
+    for (uint32_t si : world.liveSpecies) {
+        if (si >= world.species.size()) continue;
+        const SpeciesInfo& sp = world.species[si];
+        if (sp.count == 0) continue;
+
+        uint32_t slot;
+        auto it = index.find(sp.id);
+        if (it == index.end()) {
+            slot = allocSlot();
+            SpeciesTrack& t = tracks[slot];
+            t.id        = sp.id;
+            t.name      = sp.name;
+            t.color[0]  = sp.color[0];
+            t.color[1]  = sp.color[1];
+            t.color[2]  = sp.color[2];
+            t.firstSeen = now;
+            t.samples.reserve(16);
+            index.emplace(sp.id, slot);
+        } else {
+            slot = it->second;
+        }
+        SpeciesTrack& t = tracks[slot];
+        t.extinct    = false;
+        t.worldSlot  = si;
+        t.seenUpdate = updates;
+        t.add(now, sp.count, sp.allTime, &sp.centroid, trackCapacity);
+        nextLive.push_back(slot);
+    }
+
+    // Live last time but not now: record the final interval and freeze
+    for (uint32_t slot : live) {
+        SpeciesTrack& t = tracks[slot];
+        if (t.seenUpdate == updates) continue;
+        int allTime = t.prevAllTime;
+        if (t.worldSlot < world.species.size() && world.species[t.worldSlot].id == t.id)
+            allTime = world.species[t.worldSlot].allTime;
+        t.add(now, 0, allTime, nullptr, trackCapacity);
+        t.flush(trackCapacity);
+        t.extinct = true;
+        t.samples.shrink_to_fit();
+        extinctFifo.push_back(t.id);
+    }
+    live.swap(nextLive);
+    evictExtinct();
+}
+
+void SpeciesHistory::clear() {
+    tracks.clear();
+    freeSlots.clear();
+    index.clear();
+    live.clear();
+    extinctFifo.clear();
+    extinctHead = 0;
+    lastTime    = -INFINITY;
+    updates++;
+}
+
+const SpeciesTrack* SpeciesHistory::find(uint32_t id) const {
+    auto it = index.find(id);
+    return it == index.end() ? nullptr : &tracks[it->second];
+}
+
+void SpeciesHistory::topByPeak(int k, std::vector<uint32_t>& out) const {
+    std::vector<std::pair<float, uint32_t>> ranked;
+    ranked.reserve(index.size());
+    for (const auto& [id, slot] : index) ranked.push_back({ tracks[slot].peak, id });
+    size_t n = std::min(ranked.size(), (size_t)std::max(k, 0));
+    std::partial_sort(ranked.begin(), ranked.begin() + n, ranked.end(),
+                      [](const auto& a, const auto& b) {
+                          return a.first != b.first ? a.first > b.first : a.second < b.second;
+                      });
+    out.clear();
+    for (size_t i = 0; i < n; i++) out.push_back(ranked[i].second);
+}
+
+uint32_t SpeciesHistory::allocSlot() {
+    if (!freeSlots.empty()) {
+        uint32_t slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+    }
+    tracks.emplace_back();
+    return (uint32_t)tracks.size() - 1;
+}
+
+// Drop the oldest extinctions beyond the retention cap and recycle their slots
+void SpeciesHistory::evictExtinct() {
+    while (extinctFifo.size() - extinctHead > (size_t)std::max(extinctKept, 0)) {
+        uint32_t id = extinctFifo[extinctHead++];
+        auto it = index.find(id);
+        if (it == index.end() || !tracks[it->second].extinct) continue;
+        tracks[it->second] = SpeciesTrack{};   // releases the samples
+        freeSlots.push_back(it->second);
+        index.erase(it);
+    }
+    if (extinctHead > 1024 && extinctHead * 2 > extinctFifo.size()) {
+        extinctFifo.erase(extinctFifo.begin(), extinctFifo.begin() + extinctHead);
+        extinctHead = 0;
+    }
+}
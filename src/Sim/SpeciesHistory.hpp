@@ -0,0 +1,112 @@
+#pragma once
+#include "World/World.hpp"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ── SpeciesSample ─────────────────────────────────────────────────────────────
+// One species over one recording interval (one or more centroid updates).
+struct SpeciesSample {
+    float    time       = 0.f;   // simulation time at the end of the interval
+    float    population = 0.f;   // mean living members over the interval
+    uint32_t births     = 0;     // members added during the interval
+    uint32_t deaths     = 0;     // members lost during the interval
+    std::array<uint16_t, GENOME_SIZE> genes{};   // centroid raw genes, 1/65535 steps
+
+    float gene(int g) const { return genes[g] * (1.f / 65535.f); }
+};
+
+// ── SpeciesTrack ──────────────────────────────────────────────────────────────
+// The recorded life of one species. Memory per track is bounded: when the
+// sample list reaches its capacity, neighbouring samples are merged pairwise
+// and the stride (centroid updates per sample) doubles, so a lineage that
+// lives for days keeps its whole curve at progressively coarser resolution.
+struct SpeciesTrack {
+    uint32_t    id        = 0;
+    std::string name;
+    float       color[3]  = {};
+    float       firstSeen = 0.f;
+    float       lastSeen  = 0.f;
+    float       peak      = 0.f;   // largest member count seen at an update
+    bool        extinct   = false;
+
+    std::vector<SpeciesSample> samples;   // oldest first
+    int stride = 1;                       // centroid updates merged into each sample
+
+    // Sample covering time t, null outside the recorded lifetime; samples
+    // cover (previous sample time, sample time]
+    const SpeciesSample* sampleAt(float t) const;
+    float populationAt(float t) const { const SpeciesSample* s = sampleAt(t); return s ? s->population : 0.f; }
+
+private:
+    friend struct SpeciesHistory;
+
+    // Previous update's totals, for births/deaths per interval
+    int      prevCount   = 0;
+    int      prevAllTime = 0;
+    uint32_t worldSlot   = 0;   // last known index in World::species
+    uint64_t seenUpdate  = 0;   // SpeciesHistory update that last sampled it
+
+    // Updates not yet folded into a sample (stride > 1)
+    int      pendN      = 0;
+    int      pendGeneN  = 0;
+    float    pendTime   = 0.f;
+    double   pendPop    = 0;
+    uint32_t pendBirths = 0, pendDeaths = 0;
+    std::array<float, GENOME_SIZE> pendGenes{};
+
+    // centroid = null for the final, post-extinction update
+    void add(float time, int count, int allTime, const Genome* centroid, int capacity);
+    void flush(int capacity);
+    void thin();
+};
+
+// ── SpeciesHistory ────────────────────────────────────────────────────────────
+// Per-species time series, fed by World::updateSpeciesCentroids(). Storage is
+// sparse: only species alive at an update receive a sample, so an extinct
+// species stops growing the moment it dies, and its frozen track is kept
+// until `extinctKept` newer extinctions push it out. update() visits only
+// World::liveSpecies plus the tracks that were live last time, so its cost
+// follows the live species count, not the thousands that have ever existed.
+//
+// Births and deaths come from the registry's own counters: classifySpecies()
+// bumps allTime and count for every new member, and the centroid pass
+// recounts the survivors, so births = ΔallTime and deaths = births - Δcount.
+struct SpeciesHistory {
+    int trackCapacity = 256;    // samples per track before pairwise thinning
+    int extinctKept   = 2048;   // extinct tracks retained for plotting
+
+    // Record one sample per live species if the world has run a centroid
+    // update since the last call. Cheap to call every frame.
+    void update(const World& world);
+    void clear();
+
+    // Live or retained extinct track; null once evicted. Pointers stay valid
+    // until the next update().
+    const SpeciesTrack* find(uint32_t id) const;
+    size_t liveCount() const    { return live.size(); }
+    size_t trackCount() const   { return index.size(); }
+    uint64_t version() const    { return updates; }   // bumps with every recorded update
+
+    // IDs of the k retained species with the largest peak population,
+    // largest first
+    void topByPeak(int k, std::vector<uint32_t>& out) const;
+
+private:
+    std::vector<SpeciesTrack>              tracks;      // slots; free ones listed in freeSlots
+    std::vector<uint32_t>                  freeSlots;
+    std::unordered_map<uint32_t, uint32_t> index;       // species ID → slot
+    std::vector<uint32_t>                  live;        // slots of species live at the last update
+    std::vector<uint32_t>                  nextLive;    // scratch for update()
+    std::vector<uint32_t>                  extinctFifo; // species IDs in order of extinction
+    size_t                                 extinctHead = 0;
+    uint64_t                               seenUpdate  = 0;   // World::speciesUpdates last consumed
+    uint64_t                               updates     = 0;
+    float                                  lastTime    = -INFINITY;
+
+    uint32_t allocSlot();
+    void     evictExtinct();
+};
@@ -0,0 +1,252 @@
+#include "Telemetry.hpp"
+#include "Core/Trace.hpp"
+#include "Core/file_management.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+
+static constexpr uint32_t TELEMETRY_VERSION = 1;
+static constexpr size_t   DATA_HEADER_LEN   = 16;
+static constexpr size_t   INDEX_HEADER_LEN  = 8;
+
+// ── Shared helpers ────────────────────────────────────────────────────────────
+static bool readDataHeader(std::FILE* f, uint32_t& stride) {
+    char     magic[4];
+    uint32_t hdr[3];
+    if (std::fread(magic, 1, 4, f) != 4 || std::memcmp(magic, "EVOT", 4) != 0) return false;
+    if (std::fread(hdr, sizeof(uint32_t), 3, f) != 3) return false;
+    if (hdr[0] != TELEMETRY_VERSION || hdr[1] != sizeof(TelemetryRecord) || hdr[2] == 0) return false;
+    stride = hdr[2];
+    return true;
+}
+
+static uint64_t recordCount(const std::string& path) {
+    std::error_code ec;
+    uint64_t bytes = std::filesystem::file_size(path, ec);
+    if (ec || bytes < DATA_HEADER_LEN) return 0;
+    return (bytes - DATA_HEADER_LEN) / sizeof(TelemetryRecord);
+}
+
+// Time of every stride-th record, read straight from the data file
+static void scanIndex(std::FILE* f, uint64_t count, uint32_t stride, std::vector<float>& out) {
+    out.clear();
+    for (uint64_t i = 0; i < count; i += stride) {
+        float t;
+        seekFile(f, DATA_HEADER_LEN + i * sizeof(TelemetryRecord));
+        if (std::fread(&t, sizeof(float), 1, f) != 1) break;
+        out.push_back(t);
+    }
+}
+
+static bool loadIndexFile(const std::string& path, uint32_t stride, std::vector<float>& out) {
+    std::vector<uint8_t> bytes;
+    if (!readFileBytes(path, bytes) || bytes.size() < INDEX_HEADER_LEN) return false;
+    uint32_t s;
+    std::memcpy(&s, bytes.data() + 4, sizeof(s));
+    if (std::memcmp(bytes.data(), "EVTI", 4) != 0 || s != stride) return false;
+    out.resize((bytes.size() - INDEX_HEADER_LEN) / sizeof(float));
+    std::memcpy(out.data(), bytes.data() + INDEX_HEADER_LEN, out.size() * sizeof(float));
+    return true;
+}
+
+// ── TelemetryWriter ───────────────────────────────────────────────────────────
+bool TelemetryWriter::open(const std::string& p) {
+    namespace fs = std::filesystem;
+    close();
+
+    std::error_code ec;
+    bool   exists = fs::exists(p, ec) && fs::file_size(p, ec) >= DATA_HEADER_LEN;
+    std::vector<float> idx;
+    count    = 0;
+    lastTime = -1e30f;
+
+    if (exists) {
+        // Validate, truncate a torn tail, and resync the index
+        std::FILE* f = std::fopen(p.c_str(), "rb");
+        uint32_t stride = 0;
+        bool ok = f && readDataHeader(f, stride) && stride == TELEMETRY_INDEX_STRIDE;
+        if (ok) {
+            count = recordCount(p);
+            if (count > 0) {
+                seekFile(f, DATA_HEADER_LEN + (count - 1) * sizeof(TelemetryRecord));
+                ok = std::fread(&lastTime, sizeof(float), 1, f) == 1;
+            }
+            if (!loadIndexFile(p + ".idx", stride, idx) ||
+                idx.size() != (count + stride - 1) / stride)
+                scanIndex(f, count, stride, idx);
+        }
+        if (f) std::fclose(f);
+        if (!ok) return false;   // not a telemetry stream we can extend
+        fs::resize_file(p, DATA_HEADER_LEN + count * sizeof(TelemetryRecord), ec);
+    }
+
+    data  = std::fopen(p.c_str(), exists ? "ab" : "wb");
+    index = std::fopen((p + ".idx").c_str(), "wb");
+    if (!data || !index) {
+        if (data)  std::fclose(data);
+        if (index) std::fclose(index);
+        data = index = nullptr;
+        return false;
+    }
+    if (!exists) {
+        uint32_t hdr[3] = { TELEMETRY_VERSION, (uint32_t)sizeof(TelemetryRecord),
+                            TELEMETRY_INDEX_STRIDE };
+        std::fwrite("EVOT", 1, 4, data);
+        std::fwrite(hdr, sizeof(uint32_t), 3, data);
+    }
+    // The index is small; rewrite it whole on open, then append as we go
+    uint32_t stride = TELEMETRY_INDEX_STRIDE;
+    std::fwrite("EVTI", 1, 4, index);
+    std::fwrite(&stride, sizeof(stride), 1, index);
+    std::fwrite(idx.data(), sizeof(float), idx.size(), index);
+    std::fflush(data);
+    std::fflush(index);
+
+    filePath = p;
+    rejected = 0;
+    written.store(0, std::memory_order_relaxed);
+    ioError.store(false, std::memory_order_relaxed);
+    quit    = false;
+    running = true;
+    worker  = std::thread([this]{ workerLoop(); });
+    return true;
+}
+
+void TelemetryWriter::close() {
+    if (!running) return;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        quit = true;
+    }
+    cv.notify_one();
+    worker.join();
+    running = false;
+
+    if (data)  { syncFile(data);  std::fclose(data);  }
+    if (index) { syncFile(index); std::fclose(index); }
+    data = index = nullptr;
+}
+
+void TelemetryWriter::push(const TelemetryRecord& r) {
+    if (!running) return;
+    if (r.time < lastTime) { rejected++; return; }
+    lastTime = r.time;
+
+    bool wake;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        pending.push_back(r);
+        wake = pending.size() >= FLUSH_RECORDS;
+    }
+    if (wake) cv.notify_one();
+}
+
+// Append records and the index entries for any stride boundary they cross.
+bool TelemetryWriter::writeBatch(const std::vector<TelemetryRecord>& batch) {
+    if (batch.empty()) return true;
+    TRACE_SCOPE("Telemetry write");
+    bool ok = std::fwrite(batch.data(), sizeof(TelemetryRecord), batch.size(), data) == batch.size();
+    for (size_t i = 0; i < batch.size(); i++) {
+        if ((count + i) % TELEMETRY_INDEX_STRIDE != 0) continue;
+        ok &= std::fwrite(&batch[i].time, sizeof(float), 1, index) == 1;
+    }
+    count += batch.size();
+    ok &= std::fflush(data) == 0 && std::fflush(index) == 0;
+    return ok;
+}
+
+void TelemetryWriter::workerLoop() {
+    trace().nameThread("telemetry");
+    std::vector<TelemetryRecord> batch;
+    for (;;) {
+        bool stop;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            // Flush at least once a second so a crash loses little history
+            cv.wait_for(lock, std::chrono::seconds(1),
+                        [this]{ return quit || pending.size() >= FLUSH_RECORDS; });
+            batch.swap(pending);
+            stop = quit;
+        }
+        if (!writeBatch(batch)) ioError.store(true, std::memory_order_relaxed);
+        written.fetch_add(batch.size(), std::memory_order_relaxed);
+        batch.clear();
+        if (stop) return;
+    }
+}
+
+// ── TelemetryReader ───────────────────────────────────────────────────────────
+bool TelemetryReader::open(const std::string& path) {
+    if (data) std::fclose(data);
+    data = std::fopen(path.c_str(), "rb");
+    if (!data || !readDataHeader(data, stride)) return false;
+    count = recordCount(path);
+    if (!loadIndexFile(path + ".idx", stride, index) ||
+        index.size() != (count + stride - 1) / stride)
+        scanIndex(data, count, stride, index);
+    return true;
+}
+
+size_t TelemetryReader::read(uint64_t first, size_t n, TelemetryRecord* out) {
+    if (!data || first >= count) return 0;
+    n = (size_t)std::min<uint64_t>(n, count - first);
+    seekFile(data, DATA_HEADER_LEN + first * sizeof(TelemetryRecord));
+    return std::fread(out, sizeof(TelemetryRecord), n, data);
+}
+
+uint64_t TelemetryReader::seek(float t) {
+    if (index.empty()) return count;
+    // Last indexed block whose first record is still before t
+    auto it = std::lower_bound(index.begin(), index.end(), t);
+    uint64_t block = it == index.begin() ? 0 : (uint64_t)(it - index.begin() - 1);
+
+    std::vector<TelemetryRecord> buf(stride);
+    uint64_t first = block * stride;
+    size_t   n     = read(first, stride, buf.data());
+    for (size_t i = 0; i < n; i++)
+        if (buf[i].time >= t) return first + i;
+    return std::min<uint64_t>(first + n, count);
+}
+
+bool TelemetryReader::forEachInRange(float t0, float t1,
+                                     const std::function<void(const TelemetryRecord*, size_t)>& fn) {
+    if (!data) return false;
+    std::vector<TelemetryRecord> buf(16384);
+    for (uint64_t i = seek(t0); i < count; ) {
+        size_t n = read(i, buf.size(), buf.data());
+        if (n == 0) return false;
+        size_t keep = 0;
+        while (keep < n && buf[keep].time <= t1) keep++;
+        if (keep > 0) fn(buf.data(), keep);
+        if (keep < n) break;   // passed t1
+        i += n;
+    }
+    return true;
+}
+
+// ── CSV conversion ────────────────────────────────────────────────────────────
+bool telemetryToCSV(const std::string& inPath, const std::string& csvPath, float t0, float t1) {
+    TelemetryReader r;
+    if (!r.open(inPath)) return false;
+    std::FILE* out = std::fopen(csvPath.c_str(), "wb");
+    if (!out) return false;
+
+    std::fputs("time,totalPop,herbPop,carnPop,speciesCount,avgSpeed,avgSize,"
+               "avgHerbEff,avgCarnEff,avgMutRate,plantCount,births,deaths,speciations\n", out);
+    std::vector<char> buf(1 << 20);
+    bool ok = r.forEachInRange(t0, t1, [&](const TelemetryRecord* recs, size_t n) {
+        size_t used = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (buf.size() - used < 512) { std::fwrite(buf.data(), 1, used, out); used = 0; }
+            const TelemetryRecord& s = recs[i];
+            used += std::snprintf(buf.data() + used, buf.size() - used,
+                "%.3f,%u,%u,%u,%u,%.6g,%.6g,%.6g,%.6g,%.6g,%u,%u,%u,%u\n",
+                s.time, s.totalPop, s.herbPop, s.carnPop, s.speciesCount,
+                s.avgSpeed, s.avgSize, s.avgHerbEff, s.avgCarnEff, s.avgMutRate,
+                s.plantCount, s.births, s.deaths, s.speciations);
+        }
+        std::fwrite(buf.data(), 1, used, out);
+    });
+    return (std::fclose(out) == 0) && ok;
+}
@@ -0,0 +1,127 @@
+#pragma once
+// ── Telemetry.hpp ─────────────────────────────────────────────────────────────
+// Append-only binary telemetry stream ("EVOT") for the complete history of a run.
+//
+// DataRecorder keeps the recent past at full resolution and older history only
+// as coarse summaries. When a stream is open, every DataSample it takes (plus
+// the births, deaths and speciations since the previous sample) is also pushed
+// here as one fixed-size record. A worker thread batches records and appends
+// them to disk, so the frame only pays for a vector push_back.
+//
+// Files:
+//   <path>       [4] magic "EVOT"  [4] version uint32 = 1
+//                [4] recordBytes uint32  [4] indexStride uint32
+//                then TelemetryRecord × N (little-endian, native layout)
+//   <path>.idx   [4] magic "EVTI"  [4] indexStride uint32
+//                then float time of record 0, stride, 2·stride, …
+//
+// Record times are non-decreasing, so a time-range seek binary-searches the
+// small index and then scans at most `indexStride` records. A stream is
+// reopened in append mode; a torn tail record from a crash is truncated and a
+// missing or stale index is rebuilt from the records.
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct TelemetryRecord {
+    float    time         = 0.f;   // simulation time of the sample
+    uint32_t totalPop     = 0;
+    uint32_t herbPop      = 0;
+    uint32_t carnPop      = 0;
+    uint32_t speciesCount = 0;
+    float    avgSpeed     = 0.f;
+    float    avgSize      = 0.f;
+    float    avgHerbEff   = 0.f;
+    float    avgCarnEff   = 0.f;
+    float    avgMutRate   = 0.f;
+    uint32_t plantCount   = 0;
+    uint32_t births       = 0;     // events since the previous record
+    uint32_t deaths       = 0;
+    uint32_t speciations  = 0;
+};
+static_assert(sizeof(TelemetryRecord) == 56, "telemetry record layout is part of the file format");
+
+constexpr uint32_t TELEMETRY_INDEX_STRIDE = 1024;
+
+// ── Writer ────────────────────────────────────────────────────────────────────
+struct TelemetryWriter {
+    TelemetryWriter() = default;
+    ~TelemetryWriter() { close(); }
+    TelemetryWriter(const TelemetryWriter&)            = delete;
+    TelemetryWriter& operator=(const TelemetryWriter&) = delete;
+
+    // Open (or append to) the stream at `path` and start the writer thread.
+    bool open(const std::string& path);
+
+    // Flush everything pushed so far and stop the writer thread.
+    void close();
+
+    bool isOpen() const { return running; }
+    const std::string& path() const { return filePath; }
+
+    // Queue one record. Records older than the last one are rejected (and
+    // counted) so the stream stays seekable.
+    void push(const TelemetryRecord& r);
+
+    uint64_t recordsWritten() const { return written.load(std::memory_order_relaxed); }
+    uint64_t recordsRejected() const { return rejected; }
+    bool     failed() const { return ioError.load(std::memory_order_relaxed); }
+
+private:
+    void workerLoop();
+    bool writeBatch(const std::vector<TelemetryRecord>& batch);
+
+    static constexpr size_t FLUSH_RECORDS = 4096;   // wake the writer early past this
+
+    std::string  filePath;
+    std::FILE*   data  = nullptr;   // worker-only while running
+    std::FILE*   index = nullptr;
+    uint64_t     count = 0;         // records in the file (worker-only while running)
+    float        lastTime = -1e30f; // main thread
+    uint64_t     rejected = 0;      // main thread
+    bool         running  = false;  // main thread
+
+    std::thread                  worker;
+    std::mutex                   mtx;
+    std::condition_variable      cv;
+    std::vector<TelemetryRecord> pending;   // guarded by mtx
+    bool                         quit = false;   // guarded by mtx
+
+    std::atomic<uint64_t> written{0};
+    std::atomic<bool>     ioError{false};
+};
+
+// ── Reader ────────────────────────────────────────────────────────────────────
+struct TelemetryReader {
+    ~TelemetryReader() { if (data) std::fclose(data); }
+
+    bool     open(const std::string& path);
+    uint64_t size() const { return count; }
+
+    // Index of the first record with time >= t (size() if none).
+    uint64_t seek(float t);
+
+    // Read `n` records starting at record `first`; returns how many were read.
+    size_t read(uint64_t first, size_t n, TelemetryRecord* out);
+
+    // Stream every record with t0 <= time <= t1 to `fn` in batches.
+    bool forEachInRange(float t0, float t1,
+                        const std::function<void(const TelemetryRecord*, size_t)>& fn);
+
+private:
+    std::FILE*         data   = nullptr;
+    uint64_t           count  = 0;
+    uint32_t           stride = TELEMETRY_INDEX_STRIDE;
+    std::vector<float> index;   // time of every stride-th record
+};
+
+// Convert the records with t0 <= time <= t1 to CSV (header row included).
+bool telemetryToCSV(const std::string& inPath, const std::string& csvPath,
+                    float t0 = -1e30f, float t1 = 1e30f);
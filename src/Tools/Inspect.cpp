@@ -0,0 +1,497 @@
+// KyberPlanet – save-file inspector and converter
+// Reads .kybrp saves (EVOS v3 or the sectioned EVOX container) without the
+// game or a GPU. The file is memory-mapped and creature records are decoded
+// straight from the mapping on several threads, so multi-GB saves are
+// summarised in seconds and never loaded into memory whole.
+//
+//   KyberInspect info    SAVE
+//   KyberInspect species SAVE [--top N] [--sort count|alltime|id]
+//   KyberInspect genes   SAVE [--species ID] [--bins N]
+//   KyberInspect csv     SAVE OUT.csv [--species ID] [--region X Y Z R]
+//                                     [--columns default|all|GROUP,GROUP…]
+//   KyberInspect convert IN OUT [--to evox|evos]
+//   KyberInspect verify  SAVE
+//   any command: [--threads N]
+#include "World/World.hpp"
+#include "World/World_Export.hpp"
+#include "World/World_Sections.hpp"
+#include "Core/Hash.hpp"
+#include "Core/MappedFile.hpp"
+#include "Core/file_management.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct InspectOptions {
+    std::string command, in, out;
+    int         threads   = 0;      // 0 = hardware concurrency
+    int         top       = 50;
+    std::string sort      = "count";
+    int         bins      = 20;
+    int64_t     speciesID = -1;     // -1 = all species
+    bool        region    = false;
+    Vec3        regionCenter;
+    float       regionRadius = 0.f;
+    uint32_t    columns   = CSV_DEFAULT;
+    std::string to        = "evox";
+};
+
+static void usage() {
+    std::fprintf(stderr,
+        "usage: KyberInspect info    SAVE\n"
+        "       KyberInspect species SAVE [--top N] [--sort count|alltime|id]\n"
+        "       KyberInspect genes   SAVE [--species ID] [--bins N]\n"
+        "       KyberInspect csv     SAVE OUT.csv [--species ID] [--region X Y Z R]\n"
+        "                            [--columns default|all|GROUP,GROUP...]\n"
+        "       KyberInspect convert IN OUT [--to evox|evos]\n"
+        "       KyberInspect verify  SAVE\n"
+        "       any command: [--threads N]\n"
+        "CSV column groups: id species position age traits lineage name body\n"
+        "                   behavior needs genome\n");
+}
+
+static bool parseColumns(const std::string& s, uint32_t& out) {
+    static const struct { const char* key; CsvColumns bit; } groups[] = {
+        {"id", CSV_ID}, {"species", CSV_SPECIES}, {"position", CSV_POSITION},
+        {"age", CSV_AGE_ENERGY}, {"traits", CSV_TRAITS}, {"lineage", CSV_LINEAGE},
+        {"name", CSV_SPECIES_NAME}, {"body", CSV_BODY}, {"behavior", CSV_BEHAVIOR},
+        {"needs", CSV_NEEDS}, {"genome", CSV_GENOME},
+    };
+    if (s == "default") { out = CSV_DEFAULT; return true; }
+    if (s == "all")     { out = CSV_ALL;     return true; }
+    out = 0;
+    size_t at = 0;
+    while (at <= s.size()) {
+        size_t comma = s.find(',', at);
+        std::string key = s.substr(at, comma == std::string::npos ? std::string::npos : comma - at);
+        bool found = false;
+        for (const auto& g : groups)
+            if (key == g.key) { out |= g.bit; found = true; }
+        if (!found) return false;
+        if (comma == std::string::npos) break;
+        at = comma + 1;
+    }
+    return out != 0;
+}
+
+static bool parseArgs(int argc, char** argv, InspectOptions& o) {
+    if (argc < 3) return false;
+    o.command = argv[1];
+    o.in      = argv[2];
+    int i = 3;
+    if (o.command == "csv" || o.command == "convert") {
+        if (argc < 4) return false;
+        o.out = argv[i++];
+    }
+    for (; i < argc; i++) {
+        std::string a = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char* v = nullptr;
+        if      (a == "--threads" && (v = next())) o.threads = std::atoi(v);
+        else if (a == "--top"     && (v = next())) o.top = std::atoi(v);
+        else if (a == "--sort"    && (v = next())) o.sort = v;
+        else if (a == "--bins"    && (v = next())) o.bins = std::clamp(std::atoi(v), 1, 200);
+        else if (a == "--species" && (v = next())) o.speciesID = std::strtoll(v, nullptr, 10);
+        else if (a == "--to"      && (v = next())) o.to = v;
+        else if (a == "--columns" && (v = next())) { if (!parseColumns(v, o.columns)) return false; }
+        else if (a == "--region"  && i + 4 < argc) {
+            o.region = true;
+            o.regionCenter = { (float)std::atof(argv[i + 1]), (float)std::atof(argv[i + 2]),
+                               (float)std::atof(argv[i + 3]) };
+            o.regionRadius = (float)std::atof(argv[i + 4]);
+            i += 4;
+        }
+        else return false;
+    }
+    if (o.threads <= 0) o.threads = (int)std::max(1u, std::thread::hardware_concurrency());
+    return o.to == "evox" || o.to == "evos";
+}
+
+// ── SaveView ──────────────────────────────────────────────────────────────────
+// Where each record block sits inside a mapped save, for either format. The
+// creature, plant and species blocks have identical record layouts in EVOS
+// and EVOX, which is what makes conversion a streamed byte copy.
+struct SaveView {
+    bool           sectioned    = false;
+    SaveMeta       meta;
+    const uint8_t* creatures    = nullptr;   // first creature record
+    const uint8_t* plants       = nullptr;   // first plant record
+    const uint8_t* species      = nullptr;   // first species record (variable length)
+    size_t         speciesBytes = 0;
+    std::vector<SaveSection> sections;       // EVOX only
+};
+
+static bool openView(const std::string& path, const MappedFile& f, SaveView& v, std::string& err) {
+    if (f.size >= 4 && std::memcmp(f.data, "EVOX", 4) == 0) {
+        v.sectioned = true;
+        if (!parseSectionTable(f.data, f.size, v.sections)) { err = "corrupt section table"; return false; }
+        SaveFileReader r;
+        if (!r.open(path) || !r.readMeta(v.meta)) { err = "META section unreadable"; return false; }
+
+        // A block section is [count uint32][records]; the count must agree with META
+        auto block = [&](uint32_t type, uint32_t count, size_t recBytes, const uint8_t*& first) {
+            const SaveSection* s = r.find(type);
+            if (!sectionUsable(s) || s->length < 4) return false;
+            uint32_t n;
+            std::memcpy(&n, f.data + s->offset, 4);
+            first = f.data + s->offset + 4;
+            return n == count && (recBytes == 0 || 4 + (uint64_t)n * recBytes == s->length);
+        };
+        if (!block(SECTION_CREATURES, v.meta.creatures, CREATURE_RECORD_BYTES, v.creatures) ||
+            !block(SECTION_PLANTS,    v.meta.plants,    PLANT_RECORD_BYTES,    v.plants) ||
+            !block(SECTION_SPECIES,   v.meta.species,   0,                     v.species)) {
+            err = "missing, unsupported or inconsistent record section";
+            return false;
+        }
+        v.speciesBytes = (size_t)r.find(SECTION_SPECIES)->length - 4;
+        return true;
+    }
+
+    // EVOS v3: header, then three counted blocks back to back
+    ByteReader r(f.data, f.size);
+    char magic[4] = {};
+    r.read(magic, 4);
+    if (std::memcmp(magic, "EVOS", 4) != 0 || r.readU32() != 3) { err = "not an EVOS v3 or EVOX save"; return false; }
+    v.meta.simTime       = r.readF();
+    v.meta.nextID        = r.readU32();
+    v.meta.nextSpeciesID = r.readU32();
+
+    v.meta.creatures = r.readU32();
+    v.creatures      = f.data + r.pos;
+    if (!r.skip((size_t)v.meta.creatures * CREATURE_RECORD_BYTES)) { err = "truncated creature block"; return false; }
+    v.meta.plants = r.readU32();
+    v.plants      = f.data + r.pos;
+    if (!r.skip((size_t)v.meta.plants * PLANT_RECORD_BYTES)) { err = "truncated plant block"; return false; }
+    v.meta.species  = r.readU32();
+    v.species       = f.data + r.pos;
+    v.speciesBytes  = r.remaining();
+    if (!r.ok) { err = "truncated header"; return false; }
+    return true;
+}
+
+static bool decodeSpeciesBlock(const SaveView& v, std::vector<SpeciesInfo>& out) {
+    // A corrupt count mustn't size the vector: every record takes at least
+    // SPECIES_RECORD_MIN_BYTES of the block
+    if ((uint64_t)v.meta.species * SPECIES_RECORD_MIN_BYTES > v.speciesBytes) return false;
+    ByteReader r(v.species, v.speciesBytes);
+    out.resize(v.meta.species);
+    for (auto& sp : out) readSpeciesRecord(r, sp);
+    return r.ok;
+}
+
+// Run `fn(acc, creature)` over every creature record, splitting the records
+// into one contiguous range per thread. Returns the per-thread accumulators.
+template <class Acc, class Fn>
+static std::vector<Acc> scanCreatures(const SaveView& v, int threads, const Acc& init, Fn fn) {
+    const size_t n = v.meta.creatures;
+    threads = (int)std::clamp<size_t>(n / 4096, 1, (size_t)threads);
+    std::vector<Acc> acc(threads, init);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back([&, t] {
+            size_t first = n * t / threads, last = n * (t + 1) / threads;
+            ByteReader r(v.creatures + first * CREATURE_RECORD_BYTES,
+                         (last - first) * CREATURE_RECORD_BYTES);
+            Creature c;
+            for (size_t i = first; i < last; i++) {
+                readCreatureRecord(r, c);
+                fn(acc[t], c);
+            }
+        });
+    }
+    for (auto& th : pool) th.join();
+    return acc;
+}
+
+static SaveSummary scanSummary(const SaveView& v, int threads) {
+    auto parts = scanCreatures(v, threads, SummaryBuilder{},
+                               [](SummaryBuilder& b, const Creature& c) { b.add(c); });
+    SummaryBuilder total;
+    for (const auto& p : parts) total.merge(p);
+    ByteReader r(v.plants, (size_t)v.meta.plants * PLANT_RECORD_BYTES);
+    Plant p;
+    for (uint32_t i = 0; i < v.meta.plants; i++) { readPlantRecord(r, p); total.add(p); }
+    std::vector<SpeciesInfo> species;
+    decodeSpeciesBlock(v, species);
+    for (const auto& sp : species) total.add(sp);
+    return total.finish(v.meta.simTime);
+}
+
+// ── Commands ──────────────────────────────────────────────────────────────────
+static int cmdInfo(const InspectOptions& o, const MappedFile& f, const SaveView& v) {
+    std::printf("file        %s\n", o.in.c_str());
+    std::printf("format      %s, %.1f MB\n", v.sectioned ? "EVOX (sectioned)" : "EVOS v3",
+                f.size / (1024.0 * 1024.0));
+    std::printf("simTime     %.1f s (%.2f days)\n", v.meta.simTime, v.meta.simTime / 86400.0);
+    std::printf("nextID      %u   nextSpeciesID %u   tick %llu\n", v.meta.nextID, v.meta.nextSpeciesID,
+                (unsigned long long)v.meta.tickCount);
+    std::printf("records     %u creatures, %u plants, %u species\n",
+                v.meta.creatures, v.meta.plants, v.meta.species);
+
+    if (v.sectioned) {
+        std::printf("\nsection  ver  flags        offset          length\n");
+        for (const auto& s : v.sections)
+            std::printf("%-6s  %4u  %5s  %12llu  %14llu%s\n", sectionTagName(s.type).c_str(), s.version,
+                        (s.flags & SECTION_REQUIRED) ? "req" : "-",
+                        (unsigned long long)s.offset, (unsigned long long)s.length,
+                        sectionUsable(&s) ? "" : "  (not understood by this build)");
+    }
+
+    // The EVOX summary section answers instantly; EVOS needs a scan
+    SaveSummary sm;
+    SaveFileReader r;
+    bool stored = v.sectioned && r.open(o.in) && r.readSummary(sm);
+    if (!stored) sm = scanSummary(v, o.threads);
+    std::printf("\nsummary (%s)\n", stored ? "stored" : "scanned");
+    std::printf("  population   %u (%u herbivores, %u carnivores)\n", sm.population, sm.herbivores, sm.carnivores);
+    std::printf("  species      %u alive / %u total\n", sm.speciesAlive, sm.speciesTotal);
+    std::printf("  plants       %u alive\n", sm.plantsAlive);
+    std::printf("  generation   avg %.1f, max %u\n", sm.avgGeneration, sm.maxGeneration);
+    std::printf("  avg speed    %.2f m/s   avg size %.2f   avg energy %.1f\n",
+                sm.avgSpeed, sm.avgSize, sm.avgEnergy);
+    return 0;
+}
+
+static int cmdSpecies(const InspectOptions& o, const SaveView& v) {
+    std::vector<SpeciesInfo> species;
+    if (!decodeSpeciesBlock(v, species)) { std::fprintf(stderr, "corrupt species block\n"); return 1; }
+    if (o.sort == "id")
+        std::sort(species.begin(), species.end(), [](auto& a, auto& b) { return a.id < b.id; });
+    else if (o.sort == "alltime")
+        std::sort(species.begin(), species.end(), [](auto& a, auto& b) { return a.allTime > b.allTime; });
+    else
+        std::sort(species.begin(), species.end(), [](auto& a, auto& b) { return a.count > b.count; });
+
+    std::printf("%8s  %-24s %8s %9s %7s %6s %6s %6s\n",
+                "id", "name", "alive", "allTime", "speed", "size", "herb", "carn");
+    int shown = 0;
+    for (const auto& sp : species) {
+        if (o.top > 0 && shown++ >= o.top) break;
+        std::printf("%8u  %-24.24s %8d %9d %7.2f %6.2f %6.2f %6.2f\n",
+                    sp.id, sp.name.c_str(), sp.count, sp.allTime,
+                    sp.centroid.maxSpeed(), sp.centroid.bodySize(),
+                    sp.centroid.herbEfficiency(), sp.centroid.carnEfficiency());
+    }
+    if (o.top > 0 && (int)species.size() > o.top)
+        std::printf("… %zu more (use --top 0 for all)\n", species.size() - o.top);
+    return 0;
+}
+
+struct GeneAccumulator {
+    uint64_t n = 0;
+    double   sum[GENOME_SIZE] = {}, sumSq[GENOME_SIZE] = {};
+    float    lo[GENOME_SIZE], hi[GENOME_SIZE];
+    std::vector<uint64_t> hist;   // GENOME_SIZE × bins
+};
+
+static int cmdGenes(const InspectOptions& o, const SaveView& v) {
+    GeneAccumulator init;
+    std::fill(std::begin(init.lo), std::end(init.lo),  1e30f);
+    std::fill(std::begin(init.hi), std::end(init.hi), -1e30f);
+    init.hist.assign((size_t)GENOME_SIZE * o.bins, 0);
+
+    const int bins = o.bins;
+    auto parts = scanCreatures(v, o.threads, init, [&](GeneAccumulator& a, const Creature& c) {
+        if (o.speciesID >= 0 && c.speciesID != (uint32_t)o.speciesID) return;
+        a.n++;
+        for (int g = 0; g < GENOME_SIZE; g++) {
+            float x = c.genome.raw[g];
+            a.sum[g] += x; a.sumSq[g] += (double)x * x;
+            a.lo[g] = std::min(a.lo[g], x); a.hi[g] = std::max(a.hi[g], x);
+            int b = std::clamp((int)(x * bins), 0, bins - 1);
+            a.hist[(size_t)g * bins + b]++;
+        }
+    });
+    GeneAccumulator t = init;
+    for (const auto& p : parts) {
+        t.n += p.n;
+        for (int g = 0; g < GENOME_SIZE; g++) {
+            t.sum[g] += p.sum[g]; t.sumSq[g] += p.sumSq[g];
+            t.lo[g] = std::min(t.lo[g], p.lo[g]); t.hi[g] = std::max(t.hi[g], p.hi[g]);
+        }
+        for (size_t k = 0; k < t.hist.size(); k++) t.hist[k] += p.hist[k];
+    }
+    if (t.n == 0) { std::printf("no creatures matched\n"); return 0; }
+
+    // One text sparkline per gene over the raw [0,1] range
+    static const char RAMP[] = " .:-=+*#%@";
+    std::printf("%llu creatures%s\n", (unsigned long long)t.n, o.speciesID >= 0 ? " (filtered)" : "");
+    std::printf("%-13s %7s %7s %7s %7s  0%*s1\n", "gene", "mean", "sd", "min", "max", bins - 1, "");
+    for (int g = 0; g < GENOME_SIZE; g++) {
+        double mean = t.sum[g] / t.n;
+        double sd   = std::sqrt(std::max(0.0, t.sumSq[g] / t.n - mean * mean));
+        uint64_t peak = *std::max_element(t.hist.begin() + (size_t)g * bins, t.hist.begin() + (size_t)(g + 1) * bins);
+        std::string bar(bins, ' ');
+        for (int b = 0; b < bins; b++) {
+            uint64_t h = t.hist[(size_t)g * bins + b];
+            bar[b] = h == 0 ? ' ' : RAMP[std::max<uint64_t>(1, h * 9 / std::max<uint64_t>(peak, 1))];
+        }
+        std::printf("%-13s %7.4f %7.4f %7.4f %7.4f  |%s|\n", geneName(g), mean, sd, t.lo[g], t.hi[g], bar.c_str());
+    }
+    return 0;
+}
+
+static int cmdCsv(const InspectOptions& o, const SaveView& v) {
+    std::vector<SpeciesInfo> species;
+    if (!decodeSpeciesBlock(v, species)) { std::fprintf(stderr, "corrupt species block\n"); return 1; }
+
+    // Filter in bounded batches and hand each to the parallel CSV formatter
+    constexpr size_t BATCH = 1 << 16;
+    CsvExportOptions opt;
+    opt.columns = o.columns;
+    opt.threads = o.threads;
+    std::vector<Creature> batch;
+    batch.reserve(BATCH);
+    size_t rows = 0;
+    bool   first = true, ok = true;
+    auto flush = [&] {
+        opt.header = first;
+        opt.append = !first;
+        ok    = ok && exportCreaturesCSV(batch, species, o.out, opt);
+        rows += batch.size();
+        first = false;
+        batch.clear();
+    };
+
+    const float r2 = o.regionRadius * o.regionRadius;
+    ByteReader r(v.creatures, (size_t)v.meta.creatures * CREATURE_RECORD_BYTES);
+    Creature c;
+    for (uint32_t i = 0; i < v.meta.creatures && ok; i++) {
+        readCreatureRecord(r, c);
+        if (o.speciesID >= 0 && c.speciesID != (uint32_t)o.speciesID) continue;
+        if (o.region) {
+            float dx = c.pos.x - o.regionCenter.x, dy = c.pos.y - o.regionCenter.y,
+                  dz = c.pos.z - o.regionCenter.z;
+            if (dx * dx + dy * dy + dz * dz > r2) continue;
+        }
+        batch.push_back(c);
+        if (batch.size() == BATCH) flush();
+    }
+    if (!batch.empty() || first) flush();   // always write at least the header
+
+    if (!ok) { std::fprintf(stderr, "failed to write %s\n", o.out.c_str()); return 1; }
+    std::printf("%zu rows written to %s\n", rows, o.out.c_str());
+    return 0;
+}
+
+// Checksum every section of an EVOX save; returns false if any required one fails
+static bool verifySections(const MappedFile& f, const SaveView& v, bool print) {
+    bool ok = true;
+    for (const auto& s : v.sections) {
+        bool good = crc32(f.data + s.offset, (size_t)s.length) == s.crc;
+        if (!good && (s.flags & SECTION_REQUIRED)) ok = false;
+        if (print)
+            std::printf("%-6s v%-3u %12llu bytes  %s\n", sectionTagName(s.type).c_str(), s.version,
+                        (unsigned long long)s.length, good ? "ok" : "CHECKSUM MISMATCH");
+    }
+    return ok;
+}
+
+static int cmdVerify(const MappedFile& f, const SaveView& v, int threads) {
+    if (v.sectioned) {
+        bool ok = verifySections(f, v, true);
+        std::printf("%s\n", ok ? "all required sections intact" : "save is damaged");
+        return ok ? 0 : 1;
+    }
+    // EVOS carries no checksums; decode every record to check the structure
+    auto parts = scanCreatures(v, threads, 0, [](int& bad, const Creature& c) {
+        if ((uint32_t)c.behavior > (uint32_t)BehaviorState::Socializing || !std::isfinite(c.energy)) bad++;
+    });
+    int bad = 0;
+    for (int p : parts) bad += p;
+    std::vector<SpeciesInfo> species;
+    bool speciesOk = decodeSpeciesBlock(v, species);
+    std::printf("EVOS has no checksums; structure %s, %d implausible creature records\n",
+                speciesOk ? "ok" : "DAMAGED (species block)", bad);
+    return speciesOk && bad == 0 ? 0 : 1;
+}
+
+// Streams the record blocks of `v` into the other format without decoding them
+static int cmdConvert(const InspectOptions& o, const MappedFile& f, const SaveView& v) {
+    if (v.sectioned && !verifySections(f, v, false)) {
+        std::fprintf(stderr, "refusing to convert: %s has damaged sections\n", o.in.c_str());
+        return 1;
+    }
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+    const size_t crBytes = (size_t)v.meta.creatures * CREATURE_RECORD_BYTES;
+    const size_t plBytes = (size_t)v.meta.plants * PLANT_RECORD_BYTES;
+    bool ok;
+
+    if (o.to == "evox") {
+        SaveSummary sm = scanSummary(v, o.threads);
+        SaveFileWriter w;
+        ok = w.open(o.out, 5);
+
+        ByteWriter b;
+        writeMetaRecord(b, v.meta);
+        w.beginSection(SECTION_META, SECTION_REQUIRED); w.write(b); w.endSection();
+        b.clear();
+        writeSummaryRecord(b, sm);
+        w.beginSection(SECTION_SUMMARY, 0); w.write(b); w.endSection();
+
+        w.beginSection(SECTION_SPECIES, SECTION_REQUIRED);
+        w.write(&v.meta.species, 4); w.write(v.species, v.speciesBytes);
+        w.endSection();
+        w.beginSection(SECTION_CREATURES, SECTION_REQUIRED);
+        w.write(&v.meta.creatures, 4); w.write(v.creatures, crBytes);
+        w.endSection();
+        w.beginSection(SECTION_PLANTS, SECTION_REQUIRED);
+        w.write(&v.meta.plants, 4); w.write(v.plants, plBytes);
+        w.endSection();
+        ok = w.finish() && ok;
+    } else {
+        std::string tmp = o.out + ".tmp";
+        std::FILE* out = std::fopen(tmp.c_str(), "wb");
+        if (!out) { std::fprintf(stderr, "cannot create %s\n", tmp.c_str()); return 1; }
+        ByteWriter b;
+        b.write("EVOS", 4);
+        b.writeU32(3);
+        b.writeF(v.meta.simTime);
+        b.writeU32(v.meta.nextID);
+        b.writeU32(v.meta.nextSpeciesID);
+        auto put = [&](const void* p, size_t n) { ok = ok && std::fwrite(p, 1, n, out) == n; };
+        ok = true;
+        put(b.bytes.data(), b.size());
+        put(&v.meta.creatures, 4); put(v.creatures, crBytes);
+        put(&v.meta.plants, 4);    put(v.plants, plBytes);
+        put(&v.meta.species, 4);   put(v.species, v.speciesBytes);
+        ok = ok && syncFile(out);
+        ok = (std::fclose(out) == 0) && ok;
+        ok = ok ? replaceFile(tmp, o.out) : (std::remove(tmp.c_str()), false);
+    }
+
+    if (!ok) { std::fprintf(stderr, "failed to write %s\n", o.out.c_str()); return 1; }
+    double s = std::chrono::duration<double>(Clock::now() - t0).count();
+    std::printf("wrote %s (%s) in %.2f s\n", o.out.c_str(), o.to == "evox" ? "EVOX" : "EVOS v3", s);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    InspectOptions opt;
+    if (!parseArgs(argc, argv, opt)) { usage(); return 2; }
+
+    MappedFile file;
+    if (!file.open(opt.in)) { std::fprintf(stderr, "cannot open %s\n", opt.in.c_str()); return 1; }
+    SaveView view;
+    std::string err;
+    if (!openView(opt.in, file, view, err)) {
+        std::fprintf(stderr, "%s: %s\n", opt.in.c_str(), err.c_str());
+        return 1;
+    }
+
+    if (opt.command == "info")    return cmdInfo(opt, file, view);
+    if (opt.command == "species") return cmdSpecies(opt, view);
+    if (opt.command == "genes")   return cmdGenes(opt, view);
+    if (opt.command == "csv")     return cmdCsv(opt, view);
+    if (opt.command == "convert") return cmdConvert(opt, file, view);
+    if (opt.command == "verify")  return cmdVerify(file, view, opt.threads);
+    usage();
+    return 2;
+}
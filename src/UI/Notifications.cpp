@@ -12,6 +12,7 @@
 // anywhere that has access to the SimUI object.
 
 #include "UI/SimUI.hpp"
+#include "App/App_Globals.hpp"
 #include "imgui.hpp"
 #include <cstdio>
 #include <algorithm>
@@ -22,6 +23,8 @@ static constexpr float NOTIF_WIDTH       = 320.f;   // card width in pixels
 static constexpr float NOTIF_PADDING     = 10.f;    // margin from viewport edge
 static constexpr float NOTIF_AUTO_DISMISS= 30.f;    // seconds before auto-dismiss (0 = never)
 static constexpr int   NOTIF_MAX_VISIBLE = 6;       // at most this many cards on screen
+static constexpr float NOTIF_BATCH_PERIOD= 60.f;    // seconds between speciation summary cards
+static constexpr int   NOTIF_NOTABLE_SPECIES = 100; // extinct species with this many members get their own card
 
 // ── Severity colours ──────────────────────────────────────────────────────────
 static ImVec4 severityBg(NotifSeverity s) {
@@ -69,28 +72,110 @@ void SimUI::pushNotification(const std::string& title,
 }
 
 // ── tickNotifications ─────────────────────────────────────────────────────────
-// Age existing cards; fire built-in game-event checks.
-void SimUI::tickNotifications(float dt, const World& world) {
+// Age existing cards; turn simulation events into cards.
+void SimUI::tickNotifications(float dt, World& world) {
     for (auto& n : notifications) n.age += dt;
 
-    // ── Built-in trigger: low population ──────────────────────────────────────
-    int pop = 0;
-    for (const auto& c : world.creatures) if (c.alive) pop++;
-
-    {
-        bool nowLow = 0 < pop && pop < 100;
-
-        if (nowLow && !lowPopNotifFired) {
-            pushNotification(
-                "Low Population",
-                std::string("Only ") + std::to_string(pop) +
-                " creatures remain! The ecosystem is at risk of collapse.",
-                NotifSeverity::Critical,
-                world.simTime);
-            lowPopNotifFired = true;
+    // ── Simulation events ─────────────────────────────────────────────────────
+    // Drained from the world's event bus; nothing here scans the population.
+    SimEvent se;
+    char     msg[256];
+    while (world.eventBus.poll(se)) {
+        switch (se.type) {
+            case SimEventType::SpeciesFormed:
+                batchFormed++;
+                break;
+            case SimEventType::SpeciesExtinct: {
+                if ((int)se.count < NOTIF_NOTABLE_SPECIES) { batchExtinct++; break; }
+                const SpeciesInfo* sp = world.getSpecies(se.speciesID);
+                std::string name = sp ? sp->name : "Species " + std::to_string(se.speciesID);
+                std::snprintf(msg, sizeof(msg), "%s has died out after %u members.",
+                              name.c_str(), se.count);
+                pushNotification("Extinction: " + name, msg, NotifSeverity::Warning, se.simTime);
+                break;
+            }
+            case SimEventType::PopulationLow:
+                pushNotification(
+                    "Low Population",
+                    std::string("Only ") + std::to_string(se.count) +
+                    " creatures remain! The ecosystem is at risk of collapse.",
+                    NotifSeverity::Critical,
+                    se.simTime);
+                break;
+            case SimEventType::PopulationRecovered:
+                std::snprintf(msg, sizeof(msg), "Population has recovered to %u creatures.", se.count);
+                pushNotification("Population Recovered", msg, NotifSeverity::Info, se.simTime);
+                break;
+            case SimEventType::PopulationBoom:
+                std::snprintf(msg, sizeof(msg), "%u creatures, close to the limit of %u. Births will stall at the cap.",
+                              se.count, se.limit);
+                pushNotification("Population Boom", msg, NotifSeverity::Info, se.simTime);
+                break;
+            case SimEventType::MassDieOff:
+                std::snprintf(msg, sizeof(msg), "%u of %u creatures died within %.0f s.",
+                              se.count, se.limit, std::max(se.window, 1.f));
+                pushNotification("Mass Die-off", msg, NotifSeverity::Critical, se.simTime);
+                break;
+        }
+    }
+
+    batchAge += dt;
+    if ((batchFormed || batchExtinct) && batchAge >= NOTIF_BATCH_PERIOD) {
+        std::snprintf(msg, sizeof(msg), "%d new species formed, %d minor lineages died out.",
+                      batchFormed, batchExtinct);
+        pushNotification("Speciation", msg, NotifSeverity::Info, world.simTime);
+        batchFormed = batchExtinct = 0;
+        batchAge    = 0.f;
+    }
+
+    uint64_t dropped = world.eventBus.droppedCount();
+    if (dropped > eventsDropped) {
+        std::snprintf(msg, sizeof(msg), "%llu simulation events were dropped because the UI fell behind.",
+                      (unsigned long long)(dropped - eventsDropped));
+        pushNotification("Events dropped", msg, NotifSeverity::Warning, world.simTime);
+        eventsDropped = dropped;
+    }
+
+    // ── Streaming load completion ─────────────────────────────────────────────
+    if (loadStreaming && !g_loader.active()) {
+        loadStreaming = false;
+        if (g_loader.failed())
+            pushNotification("Load incomplete",
+                             "The plant section of the save is damaged; no plants were loaded.",
+                             NotifSeverity::Warning, world.simTime);
+    }
+
+    // ── Background save progress / completion ─────────────────────────────────
+    SaveEvent ev;
+    while (g_saver.pollEvent(ev)) {
+        const char* what = ev.checkpoint ? (ev.autosave ? "Auto-checkpoint" : "Checkpoint")
+                                         : (ev.autosave ? "Autosave" : "Save");
+        char buf[256];
+        switch (ev.kind) {
+            case SaveEvent::Started:
+                std::snprintf(buf, sizeof(buf), "Writing %s in the background (snapshot took %.2f ms).",
+                              ev.path.c_str(), ev.captureMs);
+                pushNotification(std::string(what) + " started", buf,
+                                 NotifSeverity::Info, ev.simTime);
+                break;
+            case SaveEvent::Finished:
+                if (ev.checkpoint)
+                    std::snprintf(buf, sizeof(buf), "%s: %s record, %.1f KB (%.1fx compressed) in %.2f s.",
+                                  ev.path.c_str(), ev.baseRecord ? "base" : "delta",
+                                  ev.bytes / 1024.0,
+                                  ev.bytes ? (double)ev.rawBytes / ev.bytes : 0.0, ev.writeSeconds);
+                else
+                    std::snprintf(buf, sizeof(buf), "%s: %.1f MB in %.2f s.",
+                                  ev.path.c_str(), ev.bytes / (1024.0 * 1024.0), ev.writeSeconds);
+                pushNotification(std::string(what) + " complete", buf,
+                                 NotifSeverity::Info, ev.simTime);
+                break;
+            case SaveEvent::Failed:
+                std::snprintf(buf, sizeof(buf), "Could not write %s.", ev.path.c_str());
+                pushNotification(std::string(what) + " failed", buf,
+                                 NotifSeverity::Critical, ev.simTime);
+                break;
         }
-        // Reset the flag once population recovers above 120 (hysteresis)
-        if (pop >= 120) lowPopNotifFired = false;
     }
 }
 
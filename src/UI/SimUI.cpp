@@ -1,6 +1,8 @@
 #include "UI/SimUI.hpp"
 #include "imgui.hpp"
 #include "implot.hpp"
+#include "implot_internal.hpp"
+#include <cfloat>
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
@@ -51,31 +53,38 @@ void SimUI::draw(World& world, DataRecorder& rec, Renderer& rend) {
     // Any change (menu-bar checkbox OR the × close button) will be caught
     // by the comparison below and trigger an immediate auto-save.
     struct WinFlags {
-        bool panels, simControls, popStats, inspector, species,
-             geneCharts, playerPanel, planetDebug, settings;
+        bool panels, simControls, popStats, inspector, species, creatures,
+             geneCharts, playerPanel, planetDebug, settings, rewind, profiler, costs;
         bool operator==(const WinFlags& o) const {
             return panels==o.panels && simControls==o.simControls &&
                    popStats==o.popStats && inspector==o.inspector &&
-                   species==o.species && geneCharts==o.geneCharts &&
+                   species==o.species && creatures==o.creatures &&
+                   geneCharts==o.geneCharts &&
                    playerPanel==o.playerPanel && planetDebug==o.planetDebug &&
-                   settings==o.settings;
+                   settings==o.settings && rewind==o.rewind &&
+                   profiler==o.profiler && costs==o.costs;
         }
     };
     auto captureFlags = [&]() -> WinFlags {
         return { showPanels, showSimControls, showPopStats, showInspector,
-                 showSpecies, showGeneCharts, showPlayerPanel,
-                 showPlanetDebug, showSettings };
+                 showSpecies, showCreatures, showGeneCharts, showPlayerPanel,
+                 showPlanetDebug, showSettings, showRewind, showProfiler, showCosts };
     };
     WinFlags before = captureFlags();
 
     // ── Normal draw ───────────────────────────────────────────────────────
     drawMainMenuBar(world, rec, rend);
+
+    // Browser rows are captured only while a browser is open
+    rec.tables.setEnabled(showPanels && (showSpecies || showCreatures));
+    rec.tables.poll();
     
     if (showPanels) {
         if (showSimControls) drawSimControls(world, rend);
         if (showPopStats)    drawPopStats(world, rec);
         if (showInspector)   drawEntityInspector(world);
-        if (showSpecies)     drawSpeciesPanel(world);
+        if (showSpecies)     drawSpeciesPanel(rec);
+        if (showCreatures)   drawCreatureBrowser(rec);
         if (showGeneCharts)  drawGeneCharts(world, rec);
         if (showPlayerPanel) drawPlayerPanel(world, rend);
 
@@ -86,6 +95,9 @@ void SimUI::draw(World& world, DataRecorder& rec, Renderer& rend) {
         }
 
         if (showSettings) drawSettingsWindow(world, rend);
+        if (showRewind)   drawRewindWindow(world);
+        if (showProfiler) drawProfiler();
+        if (showCosts)    drawCosts(world);
     }
 
     drawTerrainHoverTooltip(world);
@@ -242,6 +254,11 @@ void SimUI::drawTerrainHoverTooltip(const World& world) {
     ImGui::End();
 }
 
+void SimUI::cancelLoad() {
+    g_loader.cancel();
+    loadStreaming = false;
+}
+
 // ── Menu bar ──────────────────────────────────────────────────────────────────
 void SimUI::drawMainMenuBar(World& world, DataRecorder& rec, Renderer& rend) {
     if (!ImGui::BeginMainMenuBar()) return;
@@ -249,18 +266,131 @@ void SimUI::drawMainMenuBar(World& world, DataRecorder& rec, Renderer& rend) {
     if (ImGui::BeginMenu("File")) {
         ImGui::InputText("##savepath", savePathBuf, sizeof(savePathBuf));
         ImGui::SameLine();
-        if (ImGui::MenuItem("Save"))
-            world.saveToFile(savePathBuf);
-        if (ImGui::MenuItem("Load"))
-            world.loadFromFile(savePathBuf);
+        // Saving runs on a background thread; only the snapshot copy is paid here
+        if (ImGui::MenuItem("Save", nullptr, false, !g_saver.busy() && !g_loader.active()))
+            g_saver.requestSave(world, savePathBuf);
+        if (ImGui::MenuItem("Load", nullptr, false, !g_loader.active())) {
+            // Sectioned saves restore creatures now and stream plants in over
+            // the next frames; older EVOS files load in one go.
+            bool ok = isSectionedSave(savePathBuf) ? g_loader.begin(savePathBuf, world)
+                                                   : world.loadFromFile(savePathBuf);
+            if (ok) {
+                g_rewind.clear();   // the ring belongs to the world we just replaced
+                loadStreaming = g_loader.active();
+            } else {
+                pushNotification("Load failed", savePathBuf, NotifSeverity::Critical, world.simTime);
+            }
+        }
+        if (ImGui::IsItemHovered()) {
+            // Only the header and summary section are read, so this is instant
+            // even for very large saves
+            if (summaryPath != savePathBuf) {
+                summaryPath = savePathBuf;
+                SaveFileReader r;
+                summaryValid = r.open(summaryPath) && r.readSummary(summary);
+            }
+            if (summaryValid)
+                ImGui::SetTooltip("%s\nPopulation %u (%u herbivores, %u carnivores)\n"
+                                  "Species %u alive / %u total\nPlants %u\n"
+                                  "Generation avg %.1f, max %u",
+                                  formatGameTime(summary.simTime).c_str(),
+                                  summary.population, summary.herbivores, summary.carnivores,
+                                  summary.speciesAlive, summary.speciesTotal, summary.plantsAlive,
+                                  summary.avgGeneration, summary.maxGeneration);
+        }
+        ImGui::Separator();
+
+        // ── Incremental checkpoints ───────────────────────────────────────────
+        ImGui::InputText("##chainpath", chainPathBuf, sizeof(chainPathBuf));
+        ImGui::SameLine();
+        if (ImGui::MenuItem("Checkpoint", nullptr, false, !g_saver.busy() && !g_loader.active()))
+            g_saver.requestCheckpoint(world, chainPathBuf);
+        if (ImGui::BeginMenu("Restore Checkpoint")) {
+            if (ImGui::IsWindowAppearing())
+                listCheckpoints(chainPathBuf, chainEntries);
+            if (chainEntries.empty())
+                ImGui::TextDisabled("No checkpoints in %s", chainPathBuf);
+            for (int i = (int)chainEntries.size() - 1; i >= 0; i--) {
+                const CheckpointEntry& e = chainEntries[i];
+                char label[96];
+                std::snprintf(label, sizeof(label), "#%-3d %s  pop %-6u %s##cp%d",
+                              i, formatGameTime(e.simTime).c_str(), e.creatureCount,
+                              e.isBase ? "(base)" : "", i);
+                if (ImGui::MenuItem(label)) {
+                    WorldSnapshot snap;
+                    if (loadCheckpoint(chainPathBuf, i, snap)) {
+                        cancelLoad();
+                        world.restoreSnapshot(snap);
+                        g_rewind.clear();
+                        pushNotification("Checkpoint restored", label, NotifSeverity::Info, world.simTime);
+                    } else {
+                        pushNotification("Restore failed", chainPathBuf, NotifSeverity::Critical, world.simTime);
+                    }
+                }
+            }
+            ImGui::EndMenu();
+        }
         ImGui::Separator();
         ImGui::InputText("##csvpath", csvPathBuf, sizeof(csvPathBuf));
         ImGui::SameLine();
-        if (ImGui::MenuItem("Export CSV"))
-            world.exportCSV(csvPathBuf);
+        if (ImGui::MenuItem("Export CSV")) {
+            CsvExportOptions opt;
+            opt.columns = csvColumns;
+            CsvExportStats st;
+            if (exportCreaturesCSV(world.creatures, world.species, csvPathBuf, opt, &st)) {
+                char msg[128];
+                std::snprintf(msg, sizeof(msg), "%zu rows, %.1f MB in %.2f s (%d threads)",
+                              st.rows, st.bytes / 1048576.0, st.seconds, st.threads);
+                pushNotification("CSV exported", msg, NotifSeverity::Info, world.simTime);
+            } else {
+                pushNotification("CSV export failed", csvPathBuf, NotifSeverity::Critical, world.simTime);
+            }
+        }
+        if (ImGui::BeginMenu("CSV Columns")) {
+            for (uint32_t bit = 1; bit & CSV_ALL; bit <<= 1) {
+                bool on = (csvColumns & bit) != 0;
+                if (ImGui::Checkbox(csvColumnGroupName((CsvColumns)bit), &on))
+                    csvColumns = on ? (csvColumns | bit) : (csvColumns & ~bit);
+            }
+            ImGui::Separator();
+            if (ImGui::MenuItem("Defaults")) csvColumns = CSV_DEFAULT;
+            if (ImGui::MenuItem("Everything")) csvColumns = CSV_ALL;
+            ImGui::EndMenu();
+        }
         ImGui::Separator();
-        if (ImGui::MenuItem("Reset World"))
+
+        // ── Telemetry stream (full sample history, appended in the background) ──
+        ImGui::InputText("##telempath", telemetryPathBuf, sizeof(telemetryPathBuf));
+        ImGui::SameLine();
+        bool streaming = rec.telemetry.isOpen();
+        if (ImGui::MenuItem("Stream Telemetry", nullptr, streaming)) {
+            if (streaming)
+                rec.stopTelemetry();
+            else if (!rec.startTelemetry(telemetryPathBuf))
+                pushNotification("Telemetry failed", telemetryPathBuf, NotifSeverity::Critical, world.simTime);
+        }
+        if (streaming) {
+            ImGui::TextDisabled("%llu records written", (unsigned long long)rec.telemetry.recordsWritten());
+            if (rec.telemetry.recordsRejected() > 0)
+                ImGui::TextColored({1.f, 0.72f, 0.2f, 1.f},
+                                   "%llu samples skipped: sim time went backwards",
+                                   (unsigned long long)rec.telemetry.recordsRejected());
+            if (rec.telemetry.failed())
+                ImGui::TextColored({1.f, 0.28f, 0.28f, 1.f}, "Write error");
+        }
+        if (ImGui::MenuItem("Telemetry to CSV")) {
+            std::string out = std::string(telemetryPathBuf) + ".csv";
+            if (telemetryToCSV(telemetryPathBuf, out))
+                pushNotification("Telemetry exported", out, NotifSeverity::Info, world.simTime);
+            else
+                pushNotification("Telemetry export failed", telemetryPathBuf, NotifSeverity::Critical, world.simTime);
+        }
+        ImGui::Separator();
+        if (ImGui::MenuItem("Reset World")) {
+            cancelLoad();
             world.reset();
+            g_rewind.clear();
+        }
         ImGui::EndMenu();
     }
 
@@ -271,10 +401,14 @@ void SimUI::drawMainMenuBar(World& world, DataRecorder& rec, Renderer& rend) {
         ImGui::Checkbox("Population Statistics", &showPopStats);
         ImGui::Checkbox("Entity Inspector", &showInspector);
         ImGui::Checkbox("Species", &showSpecies);
+        ImGui::Checkbox("Creatures", &showCreatures);
         ImGui::Checkbox("Gene Evolution", &showGeneCharts);
         ImGui::Checkbox("Player Mode", &showPlayerPanel);
         ImGui::Checkbox("Planet Debug", &showPlanetDebug);
         ImGui::Checkbox("Settings", &showSettings);
+        ImGui::Checkbox("Rewind", &showRewind);
+        ImGui::Checkbox("Profiler", &showProfiler);
+        ImGui::Checkbox("Cost Attribution", &showCosts);
         ImGui::Separator();
         ImGui::Checkbox("Wireframe",   &rend.wireframe);
         ImGui::Checkbox("FOV Cone",    &rend.showFOVCone);
@@ -302,6 +436,13 @@ void SimUI::drawMainMenuBar(World& world, DataRecorder& rec, Renderer& rend) {
     // ── Sim speed indicator ───────────────────────────────────────────────────
     ImGui::TextColored({0.6f,1.f,0.6f,1.f}, "  |  ×%.1f  (-/+)", world.cfg.simSpeed);
 
+    // ── Background save progress ──────────────────────────────────────────────
+    if (g_saver.busy()) {
+        ImGui::Text("  |  Saving");
+        ImGui::SameLine();
+        ImGui::ProgressBar(g_saver.progress(), ImVec2(80.f, 0.f));
+    }
+
     // ── FPS / UPS display ─────────────────────────────────────────────────────
     // FPS = render frames per second  (how fast the GPU is presenting)
     // UPS = simulation updates per second (world.tick calls per second,
@@ -312,24 +453,25 @@ void SimUI::drawMainMenuBar(World& world, DataRecorder& rec, Renderer& rend) {
     //   >= 30 FPS → yellow   (acceptable)
     //    < 30 FPS → red      (slow)
     {
+        const Profiler& prof = profiler();
         ImVec4 fpsCol;
-        if      (displayFPS >= 60.f) fpsCol = {0.3f, 1.0f, 0.3f, 1.f};
-        else if (displayFPS >= 30.f) fpsCol = {1.0f, 0.9f, 0.2f, 1.f};
+        if      (prof.fps >= 60.f) fpsCol = {0.3f, 1.0f, 0.3f, 1.f};
+        else if (prof.fps >= 30.f) fpsCol = {1.0f, 0.9f, 0.2f, 1.f};
         else                         fpsCol = {1.0f, 0.3f, 0.2f, 1.f};
 
         // FPS with 1% low in parentheses
-        ImGui::TextColored(fpsCol, "  |  FPS: %4.0f", displayFPS);
+        ImGui::TextColored(fpsCol, "  |  FPS: %4.0f", prof.fps);
         ImGui::SameLine(0.f, 0.f);
         ImGui::TextColored(ImVec4(fpsCol.x * 0.7f, fpsCol.y * 0.7f, fpsCol.z * 0.7f, 1.f),
-            " (%3.0f)", onePctLowFPS);
+            " (%3.0f)", prof.fps1Low);
         ImGui::SameLine(0.f, 0.f);
 
         // UPS with 1% low
         ImVec4 upsCol    = {0.6f, 0.85f, 1.0f, 1.f};
         ImVec4 upsDimCol = {0.42f, 0.60f, 0.70f, 1.f};
-        ImGui::TextColored(upsCol, "  UPS: %4.0f", displayUPS);
+        ImGui::TextColored(upsCol, "  UPS: %4.0f", prof.ups);
         ImGui::SameLine(0.f, 0.f);
-        ImGui::TextColored(upsDimCol, " (%3.0f)", onePctLowUPS);
+        ImGui::TextColored(upsDimCol, " (%3.0f)", prof.ups1Low);
     }
 
     // ── Controls hint (right-aligned) ─────────────────────────────────────────
@@ -358,7 +500,10 @@ void SimUI::drawSimControls(World& world, Renderer& rend) {
         if (ImGui::Button("⏸ Pause (Space)")) world.cfg.paused = true;
     }
     ImGui::SameLine();
-    if (ImGui::Button("Reset")) world.reset();
+    if (ImGui::Button("Reset")) {
+        cancelLoad();
+        world.reset();
+    }
 
     ImGui::Separator();
 
@@ -425,6 +570,31 @@ void SimUI::drawSimControls(World& world, Renderer& rend) {
 }
 
 // ── Population stats ──────────────────────────────────────────────────────────
+// Plot one recorder series over the visible time range. The recorder picks the
+// tier whose density matches the plot's pixel width, so the point count – and
+// the frame cost – stays flat however long the run. Summarised tiers draw
+// their min/max envelope under the mean line. While ImPlot is fitting the axes
+// (first frame, double-click) the whole history is submitted so the fit spans it.
+static void plotSeries(const char* label, const DataRecorder& rec, HistorySeries s,
+                       HistoryView& view) {
+    ImPlotRect lim  = ImPlot::GetPlotLimits();   // locks setup; fit flags are final
+    int        px   = (int)ImPlot::GetPlotSize().x;
+    double     t0   = lim.X.Min, t1 = lim.X.Max;
+    if (ImPlot::GetCurrentPlot()->Axes[ImAxis_X1].FitThisFrame) {
+        t0 = rec.oldestTime();
+        t1 = rec.newestTime() + 1e-3;
+    }
+    rec.query(s, t0, t1, std::max(px, 64), view);
+    if (view.count() == 0) return;
+
+    if (view.band) {
+        ImPlotSpec band;
+        band.FillAlpha = 0.25f;
+        ImPlot::PlotShaded(label, view.t.data(), view.lo.data(), view.hi.data(), view.count(), band);
+    }
+    ImPlot::PlotLine(label, view.t.data(), view.mean.data(), view.count());
+}
+
 void SimUI::drawPopStats(const World& world, const DataRecorder& rec) {
     if (!ImGui::Begin("Population Statistics", &showPopStats)) { ImGui::End(); return; }
     int n = rec.size();
@@ -432,22 +602,143 @@ void SimUI::drawPopStats(const World& world, const DataRecorder& rec) {
     if (n > 1 && ImPlot::BeginPlot("Population", ImVec2(-1, 180))) {
         ImPlot::SetupAxes("Time (s)", "Count");
         ImPlot::SetupAxisScale(ImAxis_Y1, ImPlotScale_Log10);
-        ImPlot::PlotLine("Total",     rec.t_buf.data(), rec.total_buf.data(), n);
-        ImPlot::PlotLine("Herbivore", rec.t_buf.data(), rec.herb_buf.data(),  n);
-        ImPlot::PlotLine("Carnivore", rec.t_buf.data(), rec.carn_buf.data(),  n);
-        ImPlot::PlotLine("Plants",    rec.t_buf.data(), rec.plant_buf.data(), n);
+        plotSeries("Total",     rec, HS_TOTAL,  histView);
+        plotSeries("Herbivore", rec, HS_HERB,   histView);
+        plotSeries("Carnivore", rec, HS_CARN,   histView);
+        plotSeries("Plants",    rec, HS_PLANTS, histView);
         ImPlot::EndPlot();
     }
 
     if (n > 1 && ImPlot::BeginPlot("Species Count", ImVec2(-1, 140))) {
         ImPlot::SetupAxes("Time (s)", "Species");
-        ImPlot::PlotLine("Active Species", rec.t_buf.data(), rec.species_buf.data(), n);
+        plotSeries("Active Species", rec, HS_SPECIES, histView);
+        ImPlot::EndPlot();
+    }
+
+    if (n > 1 && ImPlot::BeginPlot("Births & Deaths", ImVec2(-1, 140))) {
+        ImPlot::SetupAxes("Time (s)", "Per sample");
+        plotSeries("Births", rec, HS_BIRTHS, histView);
+        plotSeries("Deaths", rec, HS_DEATHS, histView);
+        plotSeries("Kills",  rec, HS_KILLS,  histView);
         ImPlot::EndPlot();
     }
 
+    // ── Demographics: last sample interval next to lifetime totals ────────────
+    if (ImGui::CollapsingHeader("Demographics")) {
+        const World::EventCounters& iv  = rec.latest.interval;
+        const World::EventCounters& all = world.events;
+        if (ImGui::BeginTable("##demo", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+            ImGui::TableSetupColumn("Event");
+            ImGui::TableSetupColumn("Last sample");
+            ImGui::TableSetupColumn("Total");
+            ImGui::TableHeadersRow();
+            auto row = [](const char* name, uint64_t a, uint64_t b) {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(name);
+                ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)a);
+                ImGui::TableNextColumn(); ImGui::Text("%llu", (unsigned long long)b);
+            };
+            row("Births", iv.births, all.births);
+            row("Deaths", iv.deaths, all.deaths);
+            for (int c = 0; c < (int)DeathCause::COUNT; c++) {
+                char label[48];
+                std::snprintf(label, sizeof(label), "  %s", deathCauseName((DeathCause)c));
+                row(label, iv.deathsBy[c], all.deathsBy[c]);
+            }
+            row("Bites",           iv.bites,          all.bites);
+            row("Kills",           iv.kills,          all.kills);
+            row("Grazes",          iv.grazes,         all.grazes);
+            row("Drinks",          iv.drinks,         all.drinks);
+            row("Mates refused",   iv.mateRejections, all.mateRejections);
+            ImGui::EndTable();
+        }
+    }
+
+    drawSpeciesStack(rec);
+
     ImGui::End();
 }
 
+// ── Species stack ─────────────────────────────────────────────────────────────
+// Stacked-area population of the K species with the highest peak, alive or
+// extinct. Tracks are resampled onto one shared time grid and accumulated
+// bottom-up; that costs K × grid binary searches, so it is done only when a
+// new species update arrives, never per frame.
+void SimUI::drawSpeciesStack(const DataRecorder& rec) {
+    const SpeciesHistory& hist = rec.speciesHistory;
+    ImGui::SliderInt("Top Species", &speciesTopK, 1, 32);
+    ImGui::SameLine();
+    ImGui::TextDisabled("%zu live / %zu tracked", hist.liveCount(), hist.trackCount());
+
+    if (hist.version() != speciesStackVer || speciesTopK != speciesStackK) {
+        speciesStackVer = hist.version();
+        speciesStackK   = speciesTopK;
+        hist.topByPeak(speciesTopK, speciesStackIDs);
+
+        float t0 = FLT_MAX, t1 = -FLT_MAX;
+        for (uint32_t id : speciesStackIDs) {
+            const SpeciesTrack* tr = hist.find(id);
+            t0 = std::min(t0, tr->firstSeen);
+            t1 = std::max(t1, tr->lastSeen);
+        }
+        constexpr int GRID = 512;
+        int k = (int)speciesStackIDs.size();
+        speciesStackT.resize(GRID);
+        speciesStackY.assign((size_t)(k + 1) * GRID, 0.f);
+        for (int i = 0; i < GRID; i++)
+            speciesStackT[i] = t0 + (t1 - t0) * i / (GRID - 1);
+        for (int s = 0; s < k; s++) {
+            const SpeciesTrack* tr = hist.find(speciesStackIDs[s]);
+            const float* below = &speciesStackY[(size_t)s * GRID];
+            float*       above = &speciesStackY[(size_t)(s + 1) * GRID];
+            for (int i = 0; i < GRID; i++)
+                above[i] = below[i] + tr->populationAt(speciesStackT[i]);
+        }
+    }
+
+    int k = (int)speciesStackIDs.size();
+    if (k == 0 || !ImPlot::BeginPlot("Species Populations", ImVec2(-1, 200))) return;
+    ImPlot::SetupAxes("Time (s)", "Members");
+    ImPlot::SetupLegend(ImPlotLocation_NorthWest);
+    int grid = (int)speciesStackT.size();
+    for (int s = 0; s < k; s++) {
+        const SpeciesTrack* tr = hist.find(speciesStackIDs[s]);
+        ImPlotSpec spec;
+        spec.FillColor = ImVec4(tr->color[0], tr->color[1], tr->color[2], 1.f);
+        spec.FillAlpha = tr->extinct ? 0.45f : 0.85f;
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s%s##sp%u", tr->name.c_str(),
+                      tr->extinct ? " (extinct)" : "", tr->id);
+        ImPlot::PlotShaded(label, speciesStackT.data(),
+                           &speciesStackY[(size_t)s * grid], &speciesStackY[(size_t)(s + 1) * grid],
+                           grid, spec);
+    }
+
+    // Hover: the band under the cursor and its interval at that time
+    if (ImPlot::IsPlotHovered() && grid > 1) {
+        ImPlotPoint mp = ImPlot::GetPlotMousePos();
+        float t0 = speciesStackT.front(), t1 = speciesStackT.back();
+        int   i  = std::clamp((int)std::lround((mp.x - t0) / std::max(t1 - t0, 1e-6f) * (grid - 1)), 0, grid - 1);
+        for (int s = 0; s < k; s++) {
+            if (mp.y < speciesStackY[(size_t)s * grid + i] || mp.y > speciesStackY[(size_t)(s + 1) * grid + i])
+                continue;
+            const SpeciesTrack*  tr = hist.find(speciesStackIDs[s]);
+            const SpeciesSample* sm = tr->sampleAt((float)mp.x);
+            if (!sm) break;
+            ImGui::BeginTooltip();
+            ImGui::Text("%s  (t = %.0f s)", tr->name.c_str(), sm->time);
+            ImGui::Text("Members %.0f   +%u born  -%u died", sm->population, sm->births, sm->deaths);
+            Genome g;
+            for (int gi = 0; gi < GENOME_SIZE; gi++) g.raw[gi] = sm->gene(gi);
+            ImGui::Text("Speed %.0f   Size %.0f   Herb %.2f   Carn %.2f",
+                        g.maxSpeed(), g.bodySize(), g.herbEfficiency(), g.carnEfficiency());
+            ImGui::EndTooltip();
+            break;
+        }
+    }
+    ImPlot::EndPlot();
+}
+
 ImVec4 SimUI::get_color_from_term(const char *term) {
     ImVec4 color;
     if (strcmp(term, "Lowest") == 0)
@@ -645,14 +936,6 @@ void SimUI::drawEntityInspector(const World& world) {
 
             ImGui::Separator();
             ImGui::Text("Genome (raw [0,1]):");
-            const char* gNames[] = {
-                "BodySize","MaxSpeed","MaxSlope","VisionRange","VisionFOV",
-                "HerbEff","CarnEff","HungerRate","ThirstRate","SleepRate",
-                "LibidoRate","FearSens","SocialRate","TerritRate",
-                "DesireHealth","DesireHunger","DesireThirst","DesireSleep",
-                "DesireLibido","DesireFear","DesireSocial",
-                "GestTime","LitterBias","MutRate","MutStd","Hue","Pattern"
-            };
             for (int i = 0; i < GENOME_SIZE; i++) {
                 int count_lower = 0;
                 int count_greater = 0;
@@ -670,7 +953,7 @@ void SimUI::drawEntityInspector(const World& world) {
 
                 ImGui::ProgressBar(c.genome.raw[i], ImVec2(120, 12), "");
                 ImGui::SameLine();
-                ImGui::Text("%s  %.3f ", gNames[i], c.genome.raw[i]);
+                ImGui::Text("%s  %.3f ", geneName(i), c.genome.raw[i]);
                 ImGui::SameLine();
                 ImGui::TextColored(color, "(%s)", term);
             }
@@ -681,78 +964,434 @@ void SimUI::drawEntityInspector(const World& world) {
 }
 
 // ── Species panel ─────────────────────────────────────────────────────────────
-void SimUI::drawSpeciesPanel(const World& world) {
+// Copy a clicked header into the view; columns carry their enum as user ID
+static void applySortSpecs(TableView& view) {
+    ImGuiTableSortSpecs* specs = ImGui::TableGetSortSpecs();
+    if (!specs || !specs->SpecsDirty || specs->SpecsCount == 0) return;
+    view.column    = (int)specs->Specs[0].ColumnUserID;
+    view.ascending = specs->Specs[0].SortDirection == ImGuiSortDirection_Ascending;
+    specs->SpecsDirty = false;
+}
+
+// Rows come from DataRecorder::tables, sorted off-thread at sample time; only
+// the rows on screen are submitted (ImGuiListClipper), so the cost per frame
+// doesn't grow with the species count.
+void SimUI::drawSpeciesPanel(DataRecorder& rec) {
     if (!ImGui::Begin("Species", &showSpecies)) { ImGui::End(); return; }
 
-    // Count active
-    int activeSp = 0;
-    for (const auto& sp : world.species)
-        if (sp.count > 0) activeSp++;
-    ImGui::Text("%d active species", activeSp);
+    const TableSnapshot* snap = rec.tables.current();
+    if (!snap) { ImGui::TextDisabled("Collecting species..."); ImGui::End(); return; }
 
-    if (ImGui::BeginTable("SpeciesTable", 5,
-        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
+    ImGui::Text("%zu active species", snap->species.size());
+    ImGui::SameLine();
+    ImGui::TextDisabled("(t = %.0f s)", snap->time);
+    ImGui::SetNextItemWidth(-FLT_MIN);
+    if (ImGui::InputTextWithHint("##spfilter", "Filter by name", speciesFilterBuf, sizeof(speciesFilterBuf)))
+        speciesView.filter = speciesFilterBuf;
+
+    if (ImGui::BeginTable("SpeciesTable", SPC_COLUMNS,
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY |
+        ImGuiTableFlags_Sortable,
         ImVec2(0, 300))) {
 
-        ImGui::TableSetupColumn("Name");
-        ImGui::TableSetupColumn("Count");
-        ImGui::TableSetupColumn("All-time");
-        ImGui::TableSetupColumn("AvgSpeed");
-        ImGui::TableSetupColumn("Diet");
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Name",     ImGuiTableColumnFlags_DefaultSort, 0.f, SPC_NAME);
+        ImGui::TableSetupColumn("Count",    ImGuiTableColumnFlags_PreferSortDescending, 0.f, SPC_MEMBERS);
+        ImGui::TableSetupColumn("All-time", ImGuiTableColumnFlags_PreferSortDescending, 0.f, SPC_ALLTIME);
+        ImGui::TableSetupColumn("AvgSpeed", 0, 0.f, SPC_SPEED);
+        ImGui::TableSetupColumn("Size",     0, 0.f, SPC_SIZE);
+        ImGui::TableSetupColumn("Diet",     0, 0.f, SPC_DIET);
         ImGui::TableHeadersRow();
+        applySortSpecs(speciesView);
+        speciesView.updateSpecies(*snap);
+
+        ImGuiListClipper clipper;
+        clipper.Begin((int)speciesView.size());
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                const SpeciesRow& sp = snap->species[speciesView.row(i)];
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::PushID((int)sp.id);
+                ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(sp.color[0], sp.color[1], sp.color[2], 1.f));
+                if (ImGui::Selectable(sp.name.c_str(), chartSpeciesID == sp.id,
+                                      ImGuiSelectableFlags_SpanAllColumns))
+                    chartSpeciesID = sp.id;   // focus the gene charts on it
+                ImGui::PopStyleColor();
+                ImGui::PopID();
+                ImGui::TableSetColumnIndex(1); ImGui::Text("%d", sp.count);
+                ImGui::TableSetColumnIndex(2); ImGui::Text("%d", sp.allTime);
+                ImGui::TableSetColumnIndex(3); ImGui::Text("%.1f", sp.speed);
+                ImGui::TableSetColumnIndex(4); ImGui::Text("%.2f", sp.size);
+                ImGui::TableSetColumnIndex(5); ImGui::TextUnformatted(sp.diet());
+            }
+        }
+        ImGui::EndTable();
+    }
+    if (!speciesView.filter.empty())
+        ImGui::TextDisabled("%zu of %zu shown%s", speciesView.size(), snap->species.size(),
+                            speciesView.filtering() ? " (filtering...)" : "");
 
-        for (const auto& sp : world.species) {
-            if (sp.count == 0) continue;
-            ImGui::TableNextRow();
-            ImGui::TableSetColumnIndex(0);
-            ImGui::TextColored({sp.color[0], sp.color[1], sp.color[2], 1.f},
-                               "%s", sp.name.c_str());
-            ImGui::TableSetColumnIndex(1); ImGui::Text("%d", sp.count);
-            ImGui::TableSetColumnIndex(2); ImGui::Text("%d", sp.allTime);
-            ImGui::TableSetColumnIndex(3);
-            ImGui::Text("%.1f", sp.centroid.maxSpeed());
-            ImGui::TableSetColumnIndex(4);
-            bool isHerb = sp.centroid.herbEfficiency() > 0.5f;
-            bool isCarn = sp.centroid.carnEfficiency() > 0.5f;
-            ImGui::Text("%s", isHerb && isCarn ? "Omni" : isHerb ? "Herb" : "Carn");
+    ImGui::End();
+}
+
+// ── Creature browser ──────────────────────────────────────────────────────────
+// Same scheme as the species panel; selecting a row focuses the inspector.
+void SimUI::drawCreatureBrowser(DataRecorder& rec) {
+    if (!ImGui::Begin("Creatures", &showCreatures)) { ImGui::End(); return; }
+
+    const TableSnapshot* snap = rec.tables.current();
+    if (!snap) { ImGui::TextDisabled("Collecting creatures..."); ImGui::End(); return; }
+
+    ImGui::Text("%zu creatures", snap->creatures.size());
+    ImGui::SameLine();
+    ImGui::TextDisabled("(t = %.0f s)", snap->time);
+    ImGui::SetNextItemWidth(-FLT_MIN);
+    if (ImGui::InputTextWithHint("##crfilter", "Filter by species or state", creatureFilterBuf,
+                                 sizeof(creatureFilterBuf)))
+        creatureView.filter = creatureFilterBuf;
+
+    if (ImGui::BeginTable("CreatureTable", CRC_COLUMNS,
+        ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY |
+        ImGuiTableFlags_Sortable | ImGuiTableFlags_Resizable,
+        ImVec2(0, -ImGui::GetFrameHeightWithSpacing()))) {
+
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("ID",      ImGuiTableColumnFlags_DefaultSort, 0.f, CRC_ID);
+        ImGui::TableSetupColumn("Species", 0, 0.f, CRC_SPECIES);
+        ImGui::TableSetupColumn("Gen",     ImGuiTableColumnFlags_PreferSortDescending, 0.f, CRC_GENERATION);
+        ImGui::TableSetupColumn("Age",     ImGuiTableColumnFlags_PreferSortDescending, 0.f, CRC_AGE);
+        ImGui::TableSetupColumn("Energy",  0, 0.f, CRC_ENERGY);
+        ImGui::TableSetupColumn("Health",  0, 0.f, CRC_HEALTH);
+        ImGui::TableSetupColumn("Speed",   0, 0.f, CRC_SPEED);
+        ImGui::TableSetupColumn("Size",    0, 0.f, CRC_SIZE);
+        ImGui::TableSetupColumn("State",   0, 0.f, CRC_STATE);
+        ImGui::TableHeadersRow();
+        applySortSpecs(creatureView);
+        creatureView.updateCreatures(*snap);
+
+        ImGuiListClipper clipper;
+        clipper.Begin((int)creatureView.size());
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                const CreatureRow& c  = snap->creatures[creatureView.row(i)];
+                const SpeciesRow*  sp = snap->speciesOf(c);
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                char id[16];
+                std::snprintf(id, sizeof(id), "%u", c.id);
+                if (ImGui::Selectable(id, selectedID == c.id, ImGuiSelectableFlags_SpanAllColumns))
+                    selectedID = c.id;
+                ImGui::TableSetColumnIndex(1);
+                if (sp) ImGui::TextColored({sp->color[0], sp->color[1], sp->color[2], 1.f}, "%s", sp->name.c_str());
+                else    ImGui::TextDisabled("#%u", c.speciesID);
+                ImGui::TableSetColumnIndex(2); ImGui::Text("%u", c.generation);
+                ImGui::TableSetColumnIndex(3); ImGui::Text("%.0f", c.age);
+                ImGui::TableSetColumnIndex(4); ImGui::Text("%.0f%%", c.energy * 100.f);
+                ImGui::TableSetColumnIndex(5); ImGui::Text("%.0f%%", c.health * 100.f);
+                ImGui::TableSetColumnIndex(6); ImGui::Text("%.1f", c.speed);
+                ImGui::TableSetColumnIndex(7); ImGui::Text("%.2f", c.size);
+                ImGui::TableSetColumnIndex(8); ImGui::TextUnformatted(behaviorName(c.behavior));
+            }
         }
         ImGui::EndTable();
     }
+    if (!creatureView.filter.empty())
+        ImGui::TextDisabled("%zu of %zu shown%s", creatureView.size(), snap->creatures.size(),
+                            creatureView.filtering() ? " (filtering...)" : "");
 
     ImGui::End();
 }
 
 // ── Gene charts ───────────────────────────────────────────────────────────────
-void SimUI::drawGeneCharts(const World& world, const DataRecorder& rec) {
+void SimUI::drawGeneCharts(const World& world, DataRecorder& rec) {
     if (!ImGui::Begin("Gene Evolution", &showGeneCharts)) { ImGui::End(); return; }
     int n = rec.size();
 
     if (n > 1 && ImPlot::BeginPlot("Average Traits Over Time", ImVec2(-1, 200))) {
         ImPlot::SetupAxes("Time (s)", "Value");
-        ImPlot::PlotLine("Avg Speed",   rec.t_buf.data(), rec.speed_buf.data(),   n);
-        ImPlot::PlotLine("Avg Size",    rec.t_buf.data(), rec.size_buf.data(),    n);
-        ImPlot::PlotLine("Herb Eff",    rec.t_buf.data(), rec.herbEff_buf.data(), n);
-        ImPlot::PlotLine("Carn Eff",    rec.t_buf.data(), rec.carnEff_buf.data(), n);
+        plotSeries("Avg Speed", rec, HS_SPEED,    histView);
+        plotSeries("Avg Size",  rec, HS_SIZE,     histView);
+        plotSeries("Herb Eff",  rec, HS_HERB_EFF, histView);
+        plotSeries("Carn Eff",  rec, HS_CARN_EFF, histView);
         ImPlot::EndPlot();
     }
 
-    ImGui::Text("Gene Histogram:");
-    const char* geneNames[] = {
-        "BodySize","MaxSpeed","MaxSlope","VisionRange","VisionFOV",
-        "HerbEff","CarnEff","HungerRate","ThirstRate","SleepRate",
-        "LibidoRate","FearSens","SocialRate","TerritRate",
-        "GestTime","LitterBias","MutRate","MutStd","Hue","Pattern"
-    };
-    ImGui::Combo("Gene", &chartGeneIdx, geneNames, GENOME_SIZE);
+    // ── Gene distributions ────────────────────────────────────────────────────
+    // Built by the recorder with each sample; drawing only reads the cache.
+    // Changing bins or the per-species split recomputes once, immediately.
+    GeneHistograms& gh = rec.geneHist;
+    ImGui::SeparatorText("Gene Distributions");
+    bool rebuild = false;
+    ImGui::SetNextItemWidth(120);
+    ImGui::SliderInt("Bins", &gh.bins, 5, 64);
+    rebuild |= ImGui::IsItemDeactivatedAfterEdit();
+    ImGui::SameLine();
+    rebuild |= ImGui::Checkbox("By species", &gh.perSpecies);
+    ImGui::SameLine();
+    ImGui::Checkbox("All genes", &chartAllGenes);
+    if (rebuild) gh.compute(world);
+
+    if (gh.perSpecies) {
+        const SpeciesInfo* cur = chartSpeciesID ? world.getSpecies(chartSpeciesID) : nullptr;
+        if (ImGui::BeginCombo("Species##gh", cur ? cur->name.c_str() : "All species")) {
+            if (ImGui::Selectable("All species", chartSpeciesID == 0)) chartSpeciesID = 0;
+            for (uint32_t id : gh.species()) {
+                const SpeciesInfo* sp = world.getSpecies(id);
+                if (sp && ImGui::Selectable(sp->name.c_str(), chartSpeciesID == id)) chartSpeciesID = id;
+            }
+            ImGui::EndCombo();
+        }
+    }
+    uint32_t spID = gh.perSpecies ? chartSpeciesID : 0;
+    auto counts = [&](int g) { return spID ? gh.gene(g, spID) : gh.gene(g); };
+
+    const std::vector<float>& xs = gh.binCentres();
+    int   nb       = gh.binCount();
+    float barWidth = 0.9f / std::max(nb, 1);
+    if (!chartAllGenes) {
+        ImGui::Combo("Gene", &chartGeneIdx,
+                     [](void*, int i) { return geneName(i); }, nullptr, GENOME_SIZE);
+        const float* ys = counts(chartGeneIdx);
+        if (ys && ImPlot::BeginPlot("##GeneHist", ImVec2(-1, 160))) {
+            ImPlot::SetupAxes("Gene value [0,1]", "Count");
+            ImPlot::PlotBars("##bars", xs.data(), ys, nb, barWidth);
+            ImPlot::EndPlot();
+        }
+    } else {
+        constexpr int COLS = 3, ROWS = (GENOME_SIZE + COLS - 1) / COLS;
+        if (ImPlot::BeginSubplots("##AllGenes", ROWS, COLS, ImVec2(-1, ROWS * 90.f),
+                                  ImPlotSubplotFlags_NoResize)) {
+            for (int g = 0; g < ROWS * COLS; g++) {
+                const float* ys = g < GENOME_SIZE ? counts(g) : nullptr;
+                if (ImPlot::BeginPlot(g < GENOME_SIZE ? geneName(g) : "##pad",
+                                      ImVec2(), ImPlotFlags_NoLegend | ImPlotFlags_NoMenus)) {
+                    ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoDecorations | ImPlotAxisFlags_AutoFit,
+                                      ImPlotAxisFlags_NoDecorations | ImPlotAxisFlags_AutoFit);
+                    if (ys) ImPlot::PlotBars("##bars", xs.data(), ys, nb, barWidth);
+                    ImPlot::EndPlot();
+                }
+            }
+            ImPlot::EndSubplots();
+        }
+    }
+    ImGui::TextDisabled("%d creatures at t = %.0f s", gh.population, gh.time);
+
+    ImGui::End();
+}
+
+// ── Rewind timeline ───────────────────────────────────────────────────────────
+// Scrub through the in-memory ring of compressed past states and restore one.
+void SimUI::drawRewindWindow(World& world) {
+    if (!ImGui::Begin("Rewind", &showRewind)) { ImGui::End(); return; }
 
-    rec.geneHistogram(world, (GeneIdx)chartGeneIdx, 20, histX, histY);
-    if (!histX.empty() && ImPlot::BeginPlot("##GeneHist", ImVec2(-1, 160))) {
-        ImPlot::SetupAxes("Gene value [0,1]", "Count");
-        ImPlot::PlotBars("##bars", histX.data(), histY.data(),
-                         (int)histX.size(), 0.04f);
+    ImGui::Checkbox("Capture frames", &g_rewind.enabled);
+    ImGui::SameLine();
+    if (ImGui::Button("Clear")) { g_rewind.clear(); rewindSel = -1; }
+
+    g_rewind.listFrames(rewindFrames);
+    int n = (int)rewindFrames.size();
+    if (n == 0) {
+        ImGui::TextDisabled(g_rewind.enabled ? "Waiting for the first frame…"
+                                             : "Enable capture to record frames.");
+        ImGui::End();
+        return;
+    }
+
+    // ── Timeline ──────────────────────────────────────────────────────────────
+    rewindPop.resize(n);
+    for (int i = 0; i < n; i++) rewindPop[i] = (float)rewindFrames[i].population;
+    if (rewindSel < 0 || rewindSel >= n) rewindSel = n - 1;
+
+    ImGui::PlotLines("##rewindpop", rewindPop.data(), n, 0, "Population",
+                     0.f, FLT_MAX, ImVec2(-1, 60));
+    std::string label = formatGameTime(rewindFrames[rewindSel].simTime);
+    ImGui::SetNextItemWidth(-1);
+    ImGui::SliderInt("##rewindsel", &rewindSel, 0, n - 1, label.c_str());
+
+    const RewindFrameInfo& f = rewindFrames[rewindSel];
+    ImGui::Text("Pop %u   Species %u   %.0f s ago", f.population, f.speciesAlive,
+                world.simTime - f.simTime);
+    if (ImGui::Button("Restore Frame")) {
+        cancelLoad();
+        if (g_rewind.restore(rewindSel, world)) {
+            pushNotification("Rewound", label, NotifSeverity::Info, world.simTime);
+            rewindSel = -1;
+        } else {
+            pushNotification("Rewind failed", label, NotifSeverity::Critical, world.simTime);
+        }
+    }
+    ImGui::SameLine();
+    ImGui::TextDisabled("(newer frames are discarded)");
+
+    // ── Statistics ────────────────────────────────────────────────────────────
+    RewindStats st = g_rewind.stats();
+    ImGui::SeparatorText("Statistics");
+    ImGui::Text("Frames      %d  (%u captured, %u evicted, %u deferred)",
+                st.frames, st.captured, st.evicted, st.deferred);
+    ImGui::Text("Memory      %.1f / %d MB", st.memoryBytes / 1048576.0, g_rewind.memoryCapMB);
+    ImGui::Text("Compression %.2fx  (%.1f MB raw)",
+                st.memoryBytes ? (double)st.rawBytes / st.memoryBytes : 0.0,
+                st.rawBytes / 1048576.0);
+    ImGui::Text("Capture     %.2f ms avg  %.2f ms max  (main thread)",
+                st.avgCaptureMs, st.maxCaptureMs);
+    ImGui::Text("Compress    %.1f ms avg  %.1f ms last  (worker)",
+                st.avgCompressMs, st.lastCompressMs);
+
+    ImGui::End();
+}
+
+// ── Profiler ──────────────────────────────────────────────────────────────────
+// Built-in stage timers: the chosen stage's children stacked per frame over
+// the kept history (the top band is its untimed remainder), and per-stage
+// percentiles below.
+void SimUI::drawProfiler() {
+    if (!ImGui::Begin("Profiler", &showProfiler)) { ImGui::End(); return; }
+    Profiler& prof = profiler();
+
+    ImGui::Text("FPS %.0f (1%% low %.0f)   UPS %.0f (1%% low %.0f)",
+                prof.fps, prof.fps1Low, prof.ups, prof.ups1Low);
+    bool paused = !prof.enabled;
+    if (ImGui::Checkbox("Pause capture", &paused)) prof.enabled = !paused;
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(160.f);
+    if (ImGui::BeginCombo("Stack", profStageInfo(profRoot).name)) {
+        for (int root : { (int)PROF_FRAME, (int)PROF_TICK })
+            if (ImGui::Selectable(profStageInfo(root).name, profRoot == root)) profRoot = root;
+        ImGui::EndCombo();
+    }
+
+    // ── Stacked stage times ───────────────────────────────────────────────────
+    int children[PROF_STAGES], k = 0;
+    for (int s = 0; s < PROF_STAGES; s++)
+        if (profStageInfo(s).parent == profRoot) children[k++] = s;
+
+    int n = prof.frames();
+    profStackX.resize(n);
+    profStackY.assign((size_t)(k + 2) * n, 0.f);
+    for (int i = 0; i < n; i++) {
+        profStackX[i] = (float)(i - n + 1);
+        float sum = 0.f;
+        for (int c = 0; c < k; c++) {
+            sum += prof.sample(children[c], i);
+            profStackY[(size_t)(c + 1) * n + i] = sum;
+        }
+        profStackY[(size_t)(k + 1) * n + i] = std::max(sum, prof.sample(profRoot, i));
+    }
+
+    if (n > 1 && ImPlot::BeginPlot("##profstack", ImVec2(-1, 200))) {
+        ImPlot::SetupAxes("Frames ago", "ms", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupLegend(ImPlotLocation_NorthWest);
+        for (int c = 0; c <= k; c++) {
+            const char* label = c < k ? profStageInfo(children[c]).name
+                              : profRoot == PROF_FRAME ? "Other (vsync, untimed)" : "Other";
+            ImPlot::PlotShaded(label, profStackX.data(),
+                               &profStackY[(size_t)c * n], &profStackY[(size_t)(c + 1) * n], n);
+        }
         ImPlot::EndPlot();
     }
 
+    // ── Per-stage statistics ──────────────────────────────────────────────────
+    profStatsAge += ImGui::GetIO().DeltaTime;
+    if (profStatsAge >= 0.5f) {
+        profStatsAge = 0.f;
+        for (int s = 0; s < PROF_STAGES; s++) profStats[s] = prof.stats(s);
+    }
+
+    ImGui::TextDisabled("Last %d frames, ms", n);
+    ImGuiTableFlags tf = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+    if (ImGui::BeginTable("##profstats", 5, tf)) {
+        ImGui::TableSetupColumn("Stage", ImGuiTableColumnFlags_WidthStretch, 2.f);
+        ImGui::TableSetupColumn("Mean");
+        ImGui::TableSetupColumn("p50");
+        ImGui::TableSetupColumn("p99");
+        ImGui::TableSetupColumn("Max");
+        ImGui::TableHeadersRow();
+        for (int s = 0; s < PROF_STAGES; s++) {
+            const Profiler::Stats& st = profStats[s];
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("%*s%s", profStageDepth(s) * 2, "", profStageInfo(s).name);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", st.mean);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", st.p50);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", st.p99);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", st.max);
+        }
+        ImGui::EndTable();
+    }
+
+    // ── Trace recorder ────────────────────────────────────────────────────────
+    TraceRecorder& tr = trace();
+    if (tr.active() && ImGui::CollapsingHeader("Trace")) {
+        ImGui::TextDisabled("%llu scopes recorded; the last %zu are kept",
+                            (unsigned long long)tr.recorded(), tr.capacity());
+        if (ImGui::Button("Save trace")) {
+            std::string path = tr.dump("manual");
+            if (path.empty()) pushNotification("Trace not saved", "Could not write the trace file", NotifSeverity::Warning);
+            else              pushNotification("Trace saved", path + " (open in ui.perfetto.dev)");
+        }
+        ImGui::SameLine();
+        ImGui::Checkbox("Save at exit", &traceOnExit);
+        float slowMs = (float)tr.slowFrameMs;
+        ImGui::SetNextItemWidth(120.f);
+        if (ImGui::InputFloat("Save frames slower than (ms, 0 = off)", &slowMs, 0.f, 0.f, "%.1f"))
+            tr.slowFrameMs = std::max(slowMs, 0.f);
+    }
+
+    ImGui::End();
+}
+
+// ── Cost attribution ──────────────────────────────────────────────────────────
+void SimUI::drawCosts(World& world) {
+    if (!ImGui::Begin("Cost Attribution", &showCosts)) { ImGui::End(); return; }
+    CostAttribution& ca = world.costs;
+
+    ImGui::Checkbox("Sample", &ca.enabled);
+    ImGui::SameLine();
+    int every = (int)ca.every;
+    ImGui::SetNextItemWidth(120.f);
+    if (ImGui::SliderInt("Every N ticks", &every, 1, 120)) ca.every = (uint32_t)every;
+    ImGui::SameLine();
+    if (ImGui::Button("Reset")) ca.reset();
+
+    const CostBin& all = ca.overall();
+    if (!all.samples) {
+        ImGui::TextDisabled(ca.enabled ? "Waiting for a sampled tick..." : "Sampling is off.");
+        ImGui::End();
+        return;
+    }
+    ImGui::Text("%llu ticks, %llu creature-ticks sampled; perceive %.2f us + act %.2f us per creature",
+                (unsigned long long)ca.sampledTicks(), (unsigned long long)all.samples,
+                all.perceiveNs * 1e-3 / all.samples, all.actNs * 1e-3 / all.samples);
+
+    ImGui::SetNextItemWidth(160.f);
+    if (ImGui::BeginCombo("Group by", costGroupName(costGroup))) {
+        for (int g = 0; g < COST_GROUPS; g++)
+            if (ImGui::Selectable(costGroupName(g), costGroup == g)) costGroup = g;
+        ImGui::EndCombo();
+    }
+
+    // Shares are of sampled creature-ticks and of their summed cost
+    ImGuiTableFlags tf = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+    if (ImGui::BeginTable("##costs", 5, tf)) {
+        ImGui::TableSetupColumn(costGroupName(costGroup), ImGuiTableColumnFlags_WidthStretch, 2.f);
+        ImGui::TableSetupColumn("Creatures");
+        ImGui::TableSetupColumn("Perceive us");
+        ImGui::TableSetupColumn("Act us");
+        ImGui::TableSetupColumn("Cost");
+        ImGui::TableHeadersRow();
+        for (const CostAttribution::Row& r : ca.rows(costGroup, world)) {
+            if (!r.bin.samples) continue;
+            double costShare = (double)r.bin.totalNs() / all.totalNs();
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::TextUnformatted(r.label.c_str());
+            ImGui::TableNextColumn(); ImGui::Text("%.1f%%", 100.0 * r.bin.samples / all.samples);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", r.bin.perceiveNs * 1e-3 / r.bin.samples);
+            ImGui::TableNextColumn(); ImGui::Text("%.2f", r.bin.actNs * 1e-3 / r.bin.samples);
+            ImGui::TableNextColumn(); ImGui::ProgressBar((float)costShare, ImVec2(-1, 0), nullptr);
+        }
+        ImGui::EndTable();
+    }
+
     ImGui::End();
 }
 
@@ -836,6 +1475,42 @@ void SimUI::drawSettingsWindow(World& world, Renderer& rend) {
     SLIDER_F("Plant Grow Rate##s",     world.cfg.plantGrowRate,      0.f,   5.f)
     SLIDER_I("Max Population##s",      world.cfg.maxPopulation,      100, Renderer::MAX_CREATURES)
 
+    // ── Autosave ──────────────────────────────────────────────────────────────
+    ImGui::SeparatorText("Autosave");
+    CHECK("Enable Autosave##s",        g_saver.autosaveEnabled)
+    SLIDER_F("Interval (s)##s",        g_saver.autosaveInterval,     30.f, 3600.f)
+    SLIDER_I("Keep Newest##s",         g_saver.autosaveKeep,         1,    50)
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Older autosave_*.kybrp files are deleted\n"
+                          "after each successful autosave.");
+    CHECK("Incremental Checkpoints##s", g_saver.autosaveCheckpoint)
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Append delta checkpoints to autosave.kybrc\n"
+                          "instead of writing full rolling saves.");
+
+    // ── Rewind ────────────────────────────────────────────────────────────────
+    ImGui::SeparatorText("Rewind");
+    CHECK("Enable Rewind##s",          g_rewind.enabled)
+    SLIDER_F("Frame Interval (sim s)##s", g_rewind.interval,      5.f,  600.f)
+    SLIDER_I("Memory Cap (MB)##s",     g_rewind.memoryCapMB,         16,   4096)
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Oldest frames are evicted once the\n"
+                          "compressed ring exceeds this budget.");
+
+    // ── History ───────────────────────────────────────────────────────────────
+    ImGui::SeparatorText("History");
+    ImGui::SliderInt("Samples Kept##s", &historySamples, 600, 1000000, "%d",
+                     ImGuiSliderFlags_Logarithmic);
+    if (ImGui::IsItemDeactivatedAfterEdit()) {
+        g_recorder.setCapacity(historySamples);
+        changed = true;
+    }
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Full-resolution samples kept. Older history\n"
+                          "continues in 10 s / 1 min / 10 min summaries\n"
+                          "(24 h / 7 d / 60 d). Changing it clears the\n"
+                          "full-resolution part only.");
+
     // ── Camera ────────────────────────────────────────────────────────────────
     ImGui::SeparatorText("Camera");
     SLIDER_F("FOV##s",              rend.camera.fovY,               30.f,   120.f)
@@ -901,16 +1576,31 @@ void SimUI::saveSettingsToFile(const char* path, const World& world, const Rende
     f << "  \"showPopStats\": "     << (showPopStats ? "true" : "false") << ",\n";
     f << "  \"showInspector\": "    << (showInspector ? "true" : "false") << ",\n";
     f << "  \"showSpecies\": "      << (showSpecies ? "true" : "false") << ",\n";
+    f << "  \"showCreatures\": "    << (showCreatures ? "true" : "false") << ",\n";
     f << "  \"showGeneCharts\": "   << (showGeneCharts ? "true" : "false") << ",\n";
     f << "  \"showPlayerPanel\": "  << (showPlayerPanel ? "true" : "false") << ",\n";
     f << "  \"showPlanetDebug\": "  << (showPlanetDebug ? "true" : "false") << ",\n";
     f << "  \"showSettings\": "     << (showSettings ? "true" : "false") << ",\n";
+    f << "  \"showRewind\": "       << (showRewind ? "true" : "false") << ",\n";
+    f << "  \"showProfiler\": "     << (showProfiler ? "true" : "false") << ",\n";
+    f << "  \"showCosts\": "        << (showCosts ? "true" : "false") << ",\n";
     // Simulation
     f << "  \"simSpeed\": "             << world.cfg.simSpeed             << ",\n";
     f << "  \"mutationRateScale\": "    << world.cfg.mutationRateScale    << ",\n";
     f << "  \"speciesEpsilon\": "       << world.cfg.speciesEpsilon       << ",\n";
     f << "  \"plantGrowRate\": "        << world.cfg.plantGrowRate        << ",\n";
     f << "  \"maxPopulation\": "        << world.cfg.maxPopulation        << ",\n";
+    // Autosave
+    f << "  \"autosaveEnabled\": "      << (g_saver.autosaveEnabled ? "true" : "false") << ",\n";
+    f << "  \"autosaveInterval\": "     << g_saver.autosaveInterval       << ",\n";
+    f << "  \"autosaveKeep\": "         << g_saver.autosaveKeep           << ",\n";
+    f << "  \"autosaveCheckpoint\": "   << (g_saver.autosaveCheckpoint ? "true" : "false") << ",\n";
+    // Rewind
+    f << "  \"rewindEnabled\": "        << (g_rewind.enabled ? "true" : "false") << ",\n";
+    f << "  \"rewindInterval\": "       << g_rewind.interval              << ",\n";
+    f << "  \"rewindMemoryCapMB\": "    << g_rewind.memoryCapMB           << ",\n";
+    // History
+    f << "  \"historySamples\": "       << historySamples                 << ",\n";
     // Camera
     f << "  \"cameraFOV\": "            << rend.camera.fovY               << ",\n";
     f << "  \"cameraMoveSpeed\": "      << rend.camera.translation_speed  << ",\n";
@@ -955,15 +1645,30 @@ void SimUI::loadSettingsFromFile(const char* path, World& world, Renderer& rend)
             else if (has("\"showPopStats\""))       showPopStats                  = bval;
             else if (has("\"showInspector\""))      showInspector                 = bval;
             else if (has("\"showSpecies\""))        showSpecies                   = bval;
+            else if (has("\"showCreatures\""))      showCreatures                 = bval;
             else if (has("\"showGeneCharts\""))     showGeneCharts                = bval;
             else if (has("\"showPlayerPanel\""))    showPlayerPanel               = bval;
             else if (has("\"showPlanetDebug\""))    showPlanetDebug               = bval;
             else if (has("\"showSettings\""))       showSettings                  = bval;
+            else if (has("\"showRewind\""))         showRewind                    = bval;
+            else if (has("\"showProfiler\""))       showProfiler                  = bval;
+            else if (has("\"showCosts\""))          showCosts                     = bval;
             else if (has("\"simSpeed\""))           world.cfg.simSpeed            = std::stof(val);
             else if (has("\"mutationRateScale\""))  world.cfg.mutationRateScale   = std::stof(val);
             else if (has("\"speciesEpsilon\""))     world.cfg.speciesEpsilon      = std::stof(val);
             else if (has("\"plantGrowRate\""))      world.cfg.plantGrowRate       = std::stof(val);
             else if (has("\"maxPopulation\""))      world.cfg.maxPopulation       = std::stoi(val);
+            else if (has("\"autosaveEnabled\""))    g_saver.autosaveEnabled       = bval;
+            else if (has("\"autosaveInterval\""))   g_saver.autosaveInterval      = std::stof(val);
+            else if (has("\"autosaveKeep\""))       g_saver.autosaveKeep          = std::stoi(val);
+            else if (has("\"autosaveCheckpoint\""))  g_saver.autosaveCheckpoint    = bval;
+            else if (has("\"rewindEnabled\""))      g_rewind.enabled              = bval;
+            else if (has("\"rewindInterval\""))     g_rewind.interval             = std::stof(val);
+            else if (has("\"rewindMemoryCapMB\""))  g_rewind.memoryCapMB          = std::stoi(val);
+            else if (has("\"historySamples\"")) {
+                historySamples = std::clamp(std::stoi(val), 600, 1000000);
+                if (historySamples != g_recorder.capacity()) g_recorder.setCapacity(historySamples);
+            }
             else if (has("\"cameraFOV\""))          rend.camera.fovY              = std::stof(val);
             else if (has("\"cameraMoveSpeed\""))    rend.camera.translation_speed = std::stof(val);
             else if (has("\"followDist\""))         rend.camera.follow_dist       = std::stof(val);
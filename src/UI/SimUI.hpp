@@ -1,8 +1,13 @@
 // SimUI.h
 #pragma once
 #include "World/World.hpp"
+#include "World/World_Checkpoint.hpp"
+#include "World/World_Rewind.hpp"
+#include "World/World_Export.hpp"
+#include "World/World_Sections.hpp"
 #include "Sim/DataRecorder.hpp"
 #include "Renderer/Renderer.hpp"
+#include "Core/Profiler.hpp"
 #include <string>
 #include <vector>
 
@@ -31,11 +36,16 @@ struct SimUI {
 
     // ── Gene chart state ──────────────────────────────────────────────────────
     int        chartGeneIdx    = GENE_MAX_SPEED;
+    bool       chartAllGenes   = false;        // grid of every gene instead of one
+    uint32_t   chartSpeciesID  = 0;            // 0 = whole population
     bool       showDemoWindow  = false;
 
     // ── File path buffers ──────────────────────────────────────────────────────
     char       savePathBuf[256]= "world.kybrp";
     char       csvPathBuf[256] = "export.csv";
+    uint32_t   csvColumns      = CSV_DEFAULT;   // CsvColumns bits for Export CSV
+    char       chainPathBuf[256] = "checkpoints.kybrc";
+    char       telemetryPathBuf[256] = "telemetry.kybrt";
     char       settingsPathBuf[256] = "default.json";
 
     // ── Settings window ───────────────────────────────────────────────────────
@@ -45,12 +55,59 @@ struct SimUI {
     bool       showPopStats    = true;
     bool       showInspector   = true;
     bool       showSpecies     = true;
+    bool       showCreatures   = false;
     bool       showGeneCharts  = true;
     bool       showPlayerPanel = true;
     bool       showPlanetDebug = true;
-
-    // ── Histogram buffers ─────────────────────────────────────────────────────
-    std::vector<float> histX, histY;
+    bool       showRewind      = false;
+    bool       showProfiler    = false;
+    bool       showCosts       = false;
+    int        historySamples  = DataRecorder::DEFAULT_CAPACITY;   // recorder ring length
+
+    // ── Checkpoint chain listing (refreshed when the Restore menu opens) ──────
+    std::vector<CheckpointEntry> chainEntries;
+
+    // ── Save browsing (summary section of the file in savePathBuf) ────────────
+    std::string summaryPath;            // path the cached summary was read from
+    SaveSummary summary;
+    bool        summaryValid = false;
+    bool        loadStreaming = false;  // a sectioned load is streaming plants in
+
+    // ── Rewind timeline ───────────────────────────────────────────────────────
+    int                          rewindSel = -1;   // selected frame (-1 = newest)
+    std::vector<RewindFrameInfo> rewindFrames;     // refreshed every draw
+    std::vector<float>           rewindPop;        // population per frame, for the plot
+
+    // ── History plots ─────────────────────────────────────────────────────────
+    HistoryView histView;   // scratch for DataRecorder::query(), reused per series
+
+    // ── Species stack plot ────────────────────────────────────────────────────
+    // Rebuilt only when the species history records a new update or K changes
+    int                   speciesTopK     = 8;
+    uint64_t              speciesStackVer = ~0ull;   // SpeciesHistory::version() of the cache
+    int                   speciesStackK   = 0;
+    std::vector<uint32_t> speciesStackIDs;           // largest peak first (bottom of the stack)
+    std::vector<float>    speciesStackT;             // shared time grid
+    std::vector<float>    speciesStackY;             // (K+1) rows of cumulative population
+
+    // ── Browser tables ────────────────────────────────────────────────────────
+    // Visible rows of the Species and Creatures panels over DataRecorder::tables
+    TableView  speciesView;
+    TableView  creatureView;
+    char       speciesFilterBuf[64]  = "";
+    char       creatureFilterBuf[64] = "";
+
+    // ── Profiler panel ────────────────────────────────────────────────────────
+    // The stats table is refreshed twice a second so its numbers stay readable
+    int                 profRoot     = PROF_FRAME;   // stage whose children are stacked
+    std::vector<float>  profStackX;                  // frame index
+    std::vector<float>  profStackY;                  // (children + 2) rows of cumulative ms
+    Profiler::Stats     profStats[PROF_STAGES];
+    float               profStatsAge = 1.f;          // real seconds since refreshed
+    bool                traceOnExit  = false;        // App dumps the trace ring at shutdown
+
+    // ── Cost attribution panel ────────────────────────────────────────────────
+    int                 costGroup    = COST_BEHAVIOR;  // table shown
 
     // ── Terrain hover ─────────────────────────────────────────────────────────
     // Updated each frame from SimUI::draw() via Renderer::screenToTerrain().
@@ -63,73 +120,17 @@ struct SimUI {
     // Window dimensions passed in from main.cpp each frame
     int  windowW = 1280, windowH = 800;
 
-    struct PerformanceTracker {
-        static constexpr int RING = 300;  // ~5 seconds at 60fps
-
-        float fpsSamples[RING] = {};      // each entry = instantaneous FPS for that frame
-        float upsSamples[RING] = {};
-        int   head = 0;
-        int   count = 0;
-
-        // Rolling window accumulators (for 0.5s average display)
-        int   fpsFrameCount = 0;
-        float fpsAccum      = 0.f;
-        int   upsTickCount  = 0;
-        float upsAccum      = 0.f;
-
-        float displayFPS    = 0.f;
-        float displayUPS    = 0.f;
-        float onePctLowFPS  = 0.f;
-        float onePctLowUPS  = 0.f;
-
-        void pushFPS(float instantFPS) {
-            fpsSamples[head % RING] = instantFPS;
-            // UPS slot filled separately; mark as invalid until set
-        }
-        void pushUPS(float instantUPS) {
-            upsSamples[head % RING] = instantUPS;
-            head = (head + 1) % RING;
-            count = std::min(count + 1, RING);
-        }
-
-        // Compute the Nth percentile from an array copy (partial sort)
-        static float percentile(float* arr, int n, float pct) {
-            if (n <= 0) return 0.f;
-            // Copy to temp buffer and partial sort
-            static float tmp[RING];
-            for (int i = 0; i < n; i++) tmp[i] = arr[i];
-            int k = std::max(0, (int)(pct * n / 100.f));
-            std::nth_element(tmp, tmp + k, tmp + n);
-            return tmp[k];
-        }
-
-        void compute1PctLows() {
-            if (count == 0) return;
-            // 1% lows = bottom 1st percentile = lowest ~1% of frame rates
-            // Collect the valid window
-            int n = count;
-            float fBuf[RING], uBuf[RING];
-            for (int i = 0; i < n; i++) {
-                fBuf[i] = fpsSamples[i];
-                uBuf[i] = upsSamples[i];
-            }
-            onePctLowFPS = percentile(fBuf, n, 1.f);
-            onePctLowUPS = percentile(uBuf, n, 1.f);
-        }
-    } perf;
-
-    float displayFPS = 0.f;   // kept for SimUI internal use, mirrors perf.displayFPS
-    float displayUPS = 0.f;
-
-    float onePctLowFPS = 0.f;   // 1% low FPS (worst 1% of recent frames)
-    float onePctLowUPS = 0.f;   // 1% low UPS
-
     // ── Notifications ─────────────────────────────────────────────────────────
     // Newest first; the draw function renders them top-to-bottom in this order.
     std::vector<Notification> notifications;
 
-    // State flags for built-in triggers
-    bool lowPopNotifFired = false;
+    // Speciation is too frequent for a card per event: formations and minor
+    // extinctions drained from World::eventBus are summed here and reported
+    // as one card per batch period
+    int      batchFormed     = 0;
+    int      batchExtinct    = 0;
+    float    batchAge        = 0.f;
+    uint64_t eventsDropped   = 0;   // World::eventBus drops already reported
 
     // Push a new notification card onto the stack.
     // title     – short headline shown in the accent colour
@@ -152,22 +153,31 @@ private:
     void drawMainMenuBar(World& world, DataRecorder& rec, Renderer& rend);
     void drawSimControls(World& world, Renderer& rend);
     void drawPopStats(const World& world, const DataRecorder& rec);
+    void drawSpeciesStack(const DataRecorder& rec);
 
     ImVec4 get_color_from_term(const char *term);
 
     const char *get_term_from_term(int total, int count_lower, int count_greater);
 
     void drawEntityInspector(const World& world);
-    void drawSpeciesPanel(const World& world);
-    void drawGeneCharts(const World& world, const DataRecorder& rec);
+    void drawSpeciesPanel(DataRecorder& rec);
+    void drawCreatureBrowser(DataRecorder& rec);
+    void drawGeneCharts(const World& world, DataRecorder& rec);
     void drawPlayerPanel(World& world, Renderer& rend);
     void drawSettingsWindow(World& world, Renderer& rend);
+    void drawRewindWindow(World& world);
+    void drawProfiler();
+    void drawCosts(World& world);
     void drawTerrainHoverTooltip(const World& world);
 
     // Update terrain hover data using the renderer's ray cast
     void updateTerrainHover(const Renderer& rend, const World& world);
 
+    // Stop a streaming load before the world is replaced (restore, reset), so
+    // the old save's plants don't keep streaming into the new world
+    void cancelLoad();
+
     // Notification internals
-    void tickNotifications(float dt, const World& world);
+    void tickNotifications(float dt, World& world);
     void drawNotifications();
 };
@@ -1,10 +1,13 @@
 #pragma once
 #include "../Sim/Creature.hpp"
+#include "World_Events.hpp"
+#include "World_Costs.hpp"
 #include <vector>
 #include <unordered_map>
 #include <functional>
 #include <cstdint>
 #include <algorithm>
+#include <cstring>
 
 // ── Terrain ───────────────────────────────────────────────────────────────────
 struct VoxelColumn {
@@ -50,6 +53,45 @@ struct SimConfig {
     bool  paused            = true;      // start paused so player can survey the world first
 };
 
+// ── Demographic counters ──────────────────────────────────────────────────────
+enum class DeathCause : uint8_t {
+    Aging,          // reached lifespan
+    Starvation,     // health gave out while hunger was critical
+    Dehydration,    // health gave out while thirst was critical
+    Health,         // health gave out for any other reason
+    Predation,      // energy drained to zero by a predator's bites
+    COUNT
+};
+const char* deathCauseName(DeathCause c);
+
+// Events within one World::tick. Plain integers bumped where they happen, so
+// counting costs an increment and never allocates. Each pass that updates
+// creatures owns one block; a parallel pass gives every worker its own and
+// merges them after the join.
+struct TickCounters {
+    uint32_t deaths[(int)DeathCause::COUNT] = {};   // by cause, as creatures die
+    uint32_t births         = 0;   // offspring spawned
+    uint32_t removed        = 0;   // dead creatures compacted out this tick
+    uint32_t bites          = 0;   // ticks a predator spent biting prey
+    uint32_t kills          = 0;   // prey killed (also counted as Predation deaths)
+    uint32_t grazes         = 0;   // ticks a herbivore spent eating a plant
+    uint32_t drinks         = 0;   // ticks a creature spent drinking
+    uint32_t mateRejections = 0;   // adjacent, willing pairs refused: partner busy or genetically too far
+
+    void merge(const TickCounters& o) {
+        for (int i = 0; i < (int)DeathCause::COUNT; i++) deaths[i] += o.deaths[i];
+        births         += o.births;
+        removed        += o.removed;
+        bites          += o.bites;
+        kills          += o.kills;
+        grazes         += o.grazes;
+        drinks         += o.drinks;
+        mateRejections += o.mateRejections;
+    }
+};
+
+struct WorldSnapshot;   // World_Snapshot.hpp
+
 // Free function used by World internals and available externally
 bool sameSpecies(const Genome& a, const Genome& b, float epsilon = 0.15f);
 
@@ -116,15 +158,79 @@ struct World {
     std::vector<SpeciesInfo>             species;
     uint32_t nextSpeciesID = 1;
 
+    // Refreshed by updateSpeciesCentroids(): indices into `species` of those
+    // with living members, and a counter samplers compare to spot a new update
+    std::vector<uint32_t> liveSpecies;
+    uint64_t              speciesUpdates = 0;
+
     // Assign or find species for a genome; updates centroid
     uint32_t classifySpecies(const Genome& g);
     void     updateSpeciesCentroids();
     const SpeciesInfo* getSpecies(uint32_t id) const;
 
+    // ── Lifetime event counters ───────────────────────────────────────────────
+    // Monotonic totals for this World object (not saved, not reset by reset()
+    // or loads); samplers diff them to get per-interval rates.
+    struct EventCounters {
+        uint64_t births      = 0;   // every spawnCreature, including world generation
+        uint64_t deaths      = 0;   // creatures removed by removeDeadCreatures
+        uint64_t speciations = 0;   // new species formed by classifySpecies
+        uint64_t deathsBy[(int)DeathCause::COUNT] = {};
+        uint64_t bites = 0, kills = 0, grazes = 0, drinks = 0, mateRejections = 0;
+
+        // Fold in one tick's interaction counters (births and deaths are
+        // counted at their source, so they are not added here)
+        void add(const TickCounters& t) {
+            for (int i = 0; i < (int)DeathCause::COUNT; i++) deathsBy[i] += t.deaths[i];
+            bites          += t.bites;
+            kills          += t.kills;
+            grazes         += t.grazes;
+            drinks         += t.drinks;
+            mateRejections += t.mateRejections;
+        }
+
+        // Per-interval counts: this total minus an earlier one
+        EventCounters since(const EventCounters& prev) const {
+            EventCounters d;
+            d.births      = births      - prev.births;
+            d.deaths      = deaths      - prev.deaths;
+            d.speciations = speciations - prev.speciations;
+            for (int i = 0; i < (int)DeathCause::COUNT; i++) d.deathsBy[i] = deathsBy[i] - prev.deathsBy[i];
+            d.bites          = bites          - prev.bites;
+            d.kills          = kills          - prev.kills;
+            d.grazes         = grazes         - prev.grazes;
+            d.drinks         = drinks         - prev.drinks;
+            d.mateRejections = mateRejections - prev.mateRejections;
+            return d;
+        }
+    } events;
+
+    TickCounters lastTick;   // counters from the most recent tick()
+
+    // ── Event bus ─────────────────────────────────────────────────────────────
+    // Notable moments (speciation, extinction, population threshold crossings,
+    // mass die-offs), published by tick() for one consumer to drain.
+    SimEventBus    eventBus;
+    SimEventConfig alerts;
+
+    // ── Cost attribution ──────────────────────────────────────────────────────
+    // Off by default; when enabled, sampled ticks time each creature's
+    // perceive and act and bin the times by behaviour, traits and species.
+    CostAttribution costs;
+
     // ── Simulation ────────────────────────────────────────────────────────────
-    float simTime = 0;
+    float    simTime   = 0;
+    uint64_t tickCount = 0;   // ticks run since generate(); keys rngFor()
     void  tick(float dt);     // main simulation step
 
+    // Generator for one entity's draws of one kind during the current tick
+    // (entity 0 for world-wide draws). The tick is keyed by tickCount, which
+    // snapshots, rewind frames, checkpoints and saves carry, so a restored
+    // world replays the same draws.
+    CounterRNG rngFor(EntityID id, RngStream stream) const {
+        return CounterRNG(seed, stream, id, tickCount);
+    }
+
     // ── Initialisation ────────────────────────────────────────────────────────
     void generate(uint64_t seed, int chunksX, int chunksZ);
     void reset();
@@ -134,11 +240,21 @@ struct World {
     bool loadFromFile(const char* path);
     void exportCSV(const char* path) const;
 
+    // Bulk-copy the persistent state into `out` (reuses its capacity), or
+    // replace the live state with a previously captured snapshot.
+    void captureSnapshot(WorldSnapshot& out) const;
+    void restoreSnapshot(const WorldSnapshot& snap);
+
 private:
+    friend struct WorldBench;   // Bench/BenchSim.cpp times the private hot paths
+
     void  growPlants(float dt);
     void  tickCreatures(float dt);
-    void  handleReproduction(float dt);
-    void  perceive(Creature& c, float dt);       // update perception cache
+    void  handleReproduction(float dt, TickCounters& counters);
+    uint32_t perceive(Creature& c, float dt);    // update perception cache; returns candidates scanned
+    // The perceive and act passes of a tick `costs` samples (World_Costs.cpp)
+    void  perceiveSampled(float dt);
+    void  actSampled(float dt, TickCounters& counters);
 
     Chunk*       chunkAt(int cx, int cz);
     const Chunk* chunkAt(int cx, int cz) const;
@@ -148,6 +264,21 @@ private:
     bool isOcean(const Vec3 &worldPos) const;
     bool findOcean(const Vec3 &from, float radius, Vec3 &outPos) const;
 
+    // Per world, not a function static: two worlds in one process (the
+    // determinism checker's runs) must not share it
+    float speciesTimer = 0.f;            // sim seconds since updateSpeciesCentroids()
+
+    std::vector<int32_t> speciesSlot;   // species ID → index, scratch for updateSpeciesCentroids
+    std::vector<uint32_t> speciesWasLive; // indices live before the pass, scratch for updateSpeciesCentroids
+
+    // Population alert state for publishEvents()
+    void  publishEvents(const TickCounters& counters);
+    bool     popLow       = false;
+    bool     popBoom      = false;
+    float    dieOffStart  = -INFINITY;   // sim time the current die-off window opened
+    uint32_t dieOffPop    = 0;           // population when it opened
+    uint32_t dieOffDeaths = 0;           // removals since
+
     // Simple spatial hash for creature proximity queries
     void rebuildSpatialHash();
     void queryRadius(const Vec3& center, float radius, std::vector<uint32_t>& out) const;
@@ -0,0 +1,158 @@
+#include "World_AsyncSave.hpp"
+#include "Core/Trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+
+AsyncSaver::AsyncSaver() {
+    worker = std::thread([this]{ workerLoop(); });
+}
+
+AsyncSaver::~AsyncSaver() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        quit = true;
+    }
+    cv.notify_one();
+    // A save in flight is allowed to finish so we never leave a stray .tmp file
+    if (worker.joinable()) worker.join();
+}
+
+bool AsyncSaver::requestSave(const World& world, const std::string& path, bool autosave) {
+    return startJob(world, path, autosave, false);
+}
+
+bool AsyncSaver::requestCheckpoint(const World& world, const std::string& path, bool autosave) {
+    return startJob(world, path, autosave, true);
+}
+
+bool AsyncSaver::startJob(const World& world, const std::string& path,
+                          bool autosave, bool checkpoint) {
+    if (busy()) return false;
+
+    // Snapshot on the calling thread, between ticks; this is the only part of
+    // the save that the frame pays for.
+    using Clock = std::chrono::high_resolution_clock;
+    auto t0 = Clock::now();
+    {
+        TRACE_SCOPE("Save snapshot");
+        world.captureSnapshot(snapshot);
+    }
+    float captureMs = std::chrono::duration<float, std::milli>(Clock::now() - t0).count();
+
+    job = SaveEvent{};
+    job.path      = path;
+    job.autosave  = autosave;
+    job.checkpoint= checkpoint;
+    job.simTime   = world.simTime;
+    job.captureMs = captureMs;
+    jobRetention  = { autosaveDir, autosavePrefix, autosaveKeep };
+
+    progressVal.store(0.f, std::memory_order_relaxed);
+    busyFlag.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        hasJob = true;
+    }
+    cv.notify_one();
+
+    SaveEvent started = job;
+    started.kind = SaveEvent::Started;
+    pushEvent(started);
+    return true;
+}
+
+void AsyncSaver::tick(float realDt, const World& world) {
+    if (!autosaveEnabled) { autosaveTimer = 0.f; return; }
+    autosaveTimer += realDt;
+    if (autosaveTimer < autosaveInterval) return;
+    if (busy()) return;   // retry next frame rather than queueing behind a save
+    autosaveTimer = 0.f;
+
+    if (autosaveCheckpoint) {
+        std::filesystem::path p = std::filesystem::path(autosaveDir) / (autosavePrefix + ".kybrc");
+        requestCheckpoint(world, p.string(), true);
+        return;
+    }
+
+    // Wall-clock timestamp in the name so lexical order == chronological order
+    char stamp[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", std::localtime(&now));
+    std::filesystem::path p = std::filesystem::path(autosaveDir)
+                            / (autosavePrefix + "_" + stamp + ".kybrp");
+    requestSave(world, p.string(), true);
+}
+
+bool AsyncSaver::pollEvent(SaveEvent& out) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (events.empty()) return false;
+    out = events.front();
+    events.erase(events.begin());
+    return true;
+}
+
+void AsyncSaver::pushEvent(const SaveEvent& e) {
+    std::lock_guard<std::mutex> lock(mtx);
+    events.push_back(e);
+}
+
+void AsyncSaver::workerLoop() {
+    trace().nameThread("async save");
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this]{ return quit || hasJob; });
+            if (!hasJob) return;   // quit with nothing pending
+            hasJob = false;
+        }
+
+        using Clock = std::chrono::high_resolution_clock;
+        auto t0 = Clock::now();
+        SaveEvent done = job;
+        bool ok;
+        if (job.checkpoint) {
+            CheckpointEntry e;
+            ok = checkpoints.append(snapshot, job.path, &e);
+            done.bytes      = e.payloadBytes;
+            done.rawBytes   = e.rawBytes;
+            done.baseRecord = e.isBase;
+        } else {
+            ok = writeSectionedFile(snapshot, job.path, [this](float f){
+                progressVal.store(f, std::memory_order_relaxed);
+            });
+        }
+
+        done.kind         = ok ? SaveEvent::Finished : SaveEvent::Failed;
+        done.writeSeconds = std::chrono::duration<float>(Clock::now() - t0).count();
+        if (ok && !job.checkpoint) {
+            std::error_code ec;
+            done.bytes = std::filesystem::file_size(job.path, ec);
+            if (job.autosave) pruneAutosaves(jobRetention);
+        }
+
+        pushEvent(done);
+        busyFlag.store(false, std::memory_order_release);
+    }
+}
+
+// Delete all but the newest `r.keep` autosave files in `r.dir`. Scans the
+// directory rather than remembering names, so retention also covers previous
+// sessions.
+void AsyncSaver::pruneAutosaves(const Retention& r) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    std::vector<fs::path> found;
+    std::string head = r.prefix + "_";
+    for (const auto& e : fs::directory_iterator(r.dir, ec)) {
+        std::string name = e.path().filename().string();
+        if (name.rfind(head, 0) == 0 && e.path().extension() == ".kybrp")
+            found.push_back(e.path());
+    }
+    if ((int)found.size() <= r.keep) return;
+
+    std::sort(found.begin(), found.end());   // timestamped names sort oldest-first
+    size_t excess = found.size() - (size_t)std::max(r.keep, 1);
+    for (size_t i = 0; i < excess; i++) fs::remove(found[i], ec);
+}
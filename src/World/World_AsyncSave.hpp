@@ -0,0 +1,100 @@
+#pragma once
+// ── World_AsyncSave.hpp ───────────────────────────────────────────────────────
+// Background world saving.
+//
+// requestSave() takes a WorldSnapshot of the live world on the calling thread
+// (a bulk copy, done between ticks) and hands it to a worker thread, which
+// encodes it and writes it durably (tmp + fsync + rename). The frame never waits
+// on the disk. Progress is readable at any time; start/finish/failure events
+// are queued and drained by the UI with pollEvent().
+//
+// Autosave: when enabled, tick() fires a save every `autosaveInterval` real
+// seconds into "<autosaveDir>/<autosavePrefix>_<timestamp>.kybrp" and keeps only
+// the newest `autosaveKeep` such files. With `autosaveCheckpoint` set it instead
+// appends to the incremental chain "<autosaveDir>/<autosavePrefix>.kybrc".
+
+#include "World_Snapshot.hpp"
+#include "World_Checkpoint.hpp"
+#include "World_Sections.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct SaveEvent {
+    enum Kind { Started, Finished, Failed } kind = Started;
+    std::string path;
+    bool        autosave     = false;
+    bool        checkpoint   = false;   // appended to a chain rather than a full save
+    float       simTime      = 0.f;   // world.simTime at capture
+    float       captureMs    = 0.f;   // main-thread snapshot copy cost
+    float       writeSeconds = 0.f;   // background encode + write duration
+    uint64_t    bytes        = 0;     // final file size / record size (Finished only)
+    uint64_t    rawBytes     = 0;     // checkpoint size before compression
+    bool        baseRecord   = false; // checkpoint was a full base, not a delta
+};
+
+struct AsyncSaver {
+    // ── Autosave config (exposed in the Settings window) ──────────────────────
+    bool        autosaveEnabled  = false;
+    float       autosaveInterval = 300.f;     // real seconds between autosaves
+    int         autosaveKeep     = 5;         // rolling retention count
+    bool        autosaveCheckpoint = false;   // append to a delta chain instead
+    std::string autosaveDir      = ".";
+    std::string autosavePrefix   = "autosave";
+
+    AsyncSaver();
+    ~AsyncSaver();
+    AsyncSaver(const AsyncSaver&)            = delete;
+    AsyncSaver& operator=(const AsyncSaver&) = delete;
+
+    // Snapshot `world` now and save it in the background.
+    // Returns false (and does nothing) if a save is already in flight.
+    bool requestSave(const World& world, const std::string& path, bool autosave = false);
+
+    // Same, but append an incremental checkpoint to the chain at `path`.
+    bool requestCheckpoint(const World& world, const std::string& path, bool autosave = false);
+
+    // Advance the autosave timer; call once per frame after World::tick.
+    void tick(float realDt, const World& world);
+
+    bool  busy()     const { return busyFlag.load(std::memory_order_acquire); }
+    float progress() const { return progressVal.load(std::memory_order_relaxed); }
+
+    // Pop the oldest pending event. Returns false when the queue is empty.
+    bool pollEvent(SaveEvent& out);
+
+private:
+    bool startJob(const World& world, const std::string& path, bool autosave, bool checkpoint);
+    void workerLoop();
+    void pushEvent(const SaveEvent& e);
+
+    // Autosave retention settings as they were when the job started; the UI
+    // may change the public ones while the worker prunes
+    struct Retention {
+        std::string dir, prefix;
+        int         keep = 5;
+    };
+    static void pruneAutosaves(const Retention& r);
+
+    std::thread             worker;
+    std::mutex              mtx;
+    std::condition_variable cv;
+    bool                    quit   = false;   // guarded by mtx
+    bool                    hasJob = false;   // guarded by mtx
+
+    // Job slot: written by the main thread only while !busy, read by the worker
+    WorldSnapshot    snapshot;
+    SaveEvent        job;
+    Retention        jobRetention;
+    CheckpointWriter checkpoints;   // worker-only; keeps the previous state for deltas
+
+    std::atomic<bool>  busyFlag{false};
+    std::atomic<float> progressVal{0.f};
+
+    std::vector<SaveEvent> events;   // guarded by mtx
+
+    float autosaveTimer = 0.f;
+};
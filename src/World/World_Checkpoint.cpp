@@ -0,0 +1,464 @@
+#include "World_Checkpoint.hpp"
+#include "Core/Compress.hpp"
+#include "Core/Trace.hpp"
+#include "Core/file_management.hpp"
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+
+static constexpr uint32_t CHAIN_VERSION     = 1;
+static constexpr size_t   RECORD_HEADER_LEN = 20;
+
+// ── Mutable creature fields ───────────────────────────────────────────────────
+// The per-tick state of a survivor, packed as 32-bit words so it can be XOR'd
+// against the previous checkpoint bit-exactly.
+static constexpr int MUTABLE_WORDS = 3 + 3 + 1 + DRIVE_COUNT + 2 + 3;
+static constexpr size_t MUTABLE_BYTES = MUTABLE_WORDS * sizeof(uint32_t);
+
+static void packMutable(const Creature& c, uint32_t* w) {
+    float f[3 + 3 + 1 + DRIVE_COUNT + 2] = {
+        c.pos.x, c.pos.y, c.pos.z, c.vel.x, c.vel.y, c.vel.z, c.yaw };
+    for (int i = 0; i < DRIVE_COUNT; i++) f[7 + i] = c.needs.urgency[i];
+    f[7 + DRIVE_COUNT]     = c.energy;
+    f[7 + DRIVE_COUNT + 1] = c.age;
+    std::memcpy(w, f, sizeof(f));
+    int k = (int)(sizeof(f) / sizeof(float));
+    w[k]     = static_cast<uint32_t>(c.behavior);
+    std::memcpy(&w[k + 1], &c.gestTimer, sizeof(float));
+    w[k + 2] = c.mateTarget;
+}
+
+static void unpackMutable(const uint32_t* w, Creature& c) {
+    float f[3 + 3 + 1 + DRIVE_COUNT + 2];
+    std::memcpy(f, w, sizeof(f));
+    c.pos = {f[0], f[1], f[2]};
+    c.vel = {f[3], f[4], f[5]};
+    c.yaw = f[6];
+    for (int i = 0; i < DRIVE_COUNT; i++) c.needs.urgency[i] = f[7 + i];
+    c.energy = f[7 + DRIVE_COUNT];
+    c.age    = f[7 + DRIVE_COUNT + 1];
+    int k = (int)(sizeof(f) / sizeof(float));
+    c.behavior = static_cast<BehaviorState>(w[k]);
+    std::memcpy(&c.gestTimer, &w[k + 1], sizeof(float));
+    c.mateTarget = w[k + 2];
+}
+
+// Append a compressed block; `raw` accumulates the uncompressed size for stats
+static void putBlock(std::vector<uint8_t>& out, const ByteWriter& w, size_t stride, size_t& raw) {
+    Compress::compress(w.bytes.data(), w.size(), stride, out);
+    raw += w.size();
+}
+
+static bool getBlock(const uint8_t* data, size_t size, size_t& pos, std::vector<uint8_t>& out) {
+    size_t used = Compress::decompress(data + pos, size - pos, out);
+    if (used == 0) return false;
+    pos += used;
+    return true;
+}
+
+// Keep only alive creatures; this is what the chain records and diffs against
+static void aliveOnly(const WorldSnapshot& in, WorldSnapshot& out) {
+    out.simTime       = in.simTime;
+    out.tickCount     = in.tickCount;
+    out.nextID        = in.nextID;
+    out.nextSpeciesID = in.nextSpeciesID;
+    out.creatures.clear();
+    out.creatures.reserve(in.creatures.size());
+    for (const auto& c : in.creatures) if (c.alive) out.creatures.push_back(c);
+    out.plants  = in.plants;
+    out.species = in.species;
+}
+
+// ── Species diffing ───────────────────────────────────────────────────────────
+// The species registry only ever grows (extinct entries keep their slot), so a
+// delta stores a changed-bitmap over the previous entries plus the new tail.
+// If the previous list isn't a prefix of the current one, it is stored whole.
+static bool speciesIsPrefix(const WorldSnapshot& prev, const WorldSnapshot& cur) {
+    if (prev.species.size() > cur.species.size()) return false;
+    for (size_t i = 0; i < prev.species.size(); i++)
+        if (prev.species[i].id != cur.species[i].id) return false;
+    return true;
+}
+
+static bool sameSpeciesRecord(const SpeciesInfo& a, const SpeciesInfo& b) {
+    return a.count == b.count && a.allTime == b.allTime && a.name == b.name &&
+           std::memcmp(a.color, b.color, sizeof(a.color)) == 0 &&
+           std::memcmp(a.centroid.raw.data(), b.centroid.raw.data(),
+                       sizeof(float) * GENOME_SIZE) == 0;
+}
+
+// ── Encoders ──────────────────────────────────────────────────────────────────
+static void encodeBase(const WorldSnapshot& s, std::vector<uint8_t>& out, size_t& raw) {
+    ByteWriter meta, cr, pl, sp;
+    meta.writeF(s.simTime);
+    meta.writeU32(s.nextID);
+    meta.writeU32(s.nextSpeciesID);
+    meta.writeU32((uint32_t)s.creatures.size());
+    meta.writeU32((uint32_t)s.plants.size());
+    meta.writeU32((uint32_t)s.species.size());
+    meta.writeU64(s.tickCount);
+
+    cr.reserve(s.creatures.size() * CREATURE_RECORD_BYTES);
+    for (const auto& c : s.creatures) writeCreatureRecord(cr, c);
+    for (const auto& p : s.plants)    writePlantRecord(pl, p);
+    for (const auto& x : s.species)   writeSpeciesRecord(sp, x);
+
+    putBlock(out, meta, 1, raw);
+    putBlock(out, cr, CREATURE_RECORD_BYTES, raw);
+    putBlock(out, pl, PLANT_RECORD_BYTES, raw);
+    putBlock(out, sp, 1, raw);
+}
+
+// Both creature lists are sorted by id (spawn appends with increasing ids and
+// removal preserves order), so survivors/deaths/births fall out of a merge walk.
+static void encodeDelta(const WorldSnapshot& prev, const WorldSnapshot& cur,
+                        std::vector<uint8_t>& out, size_t& raw) {
+    ByteWriter removed, bitmap, changes, added, pl, sp;
+    std::vector<uint8_t> bits;
+    uint32_t survivors = 0;
+
+    size_t i = 0, j = 0;
+    uint32_t a[MUTABLE_WORDS], b[MUTABLE_WORDS];
+    while (i < prev.creatures.size() || j < cur.creatures.size()) {
+        EntityID pid = i < prev.creatures.size() ? prev.creatures[i].id : UINT32_MAX;
+        EntityID cid = j < cur.creatures.size()  ? cur.creatures[j].id  : UINT32_MAX;
+        if (pid < cid) {                      // died since the last checkpoint
+            removed.writeU32(pid);
+            i++;
+        } else if (cid < pid) {               // born since the last checkpoint
+            writeCreatureRecord(added, cur.creatures[j]);
+            j++;
+        } else {                              // survivor: XOR mutable fields
+            packMutable(prev.creatures[i], a);
+            packMutable(cur.creatures[j], b);
+            bool changed = false;
+            for (int k = 0; k < MUTABLE_WORDS; k++) { a[k] ^= b[k]; changed |= a[k] != 0; }
+            if ((survivors & 7) == 0) bits.push_back(0);
+            if (changed) {
+                bits.back() |= (uint8_t)(1u << (survivors & 7));
+                changes.write(a, MUTABLE_BYTES);
+            }
+            survivors++;
+            i++; j++;
+        }
+    }
+    bitmap.write(bits.data(), bits.size());
+    for (const auto& p : cur.plants)  writePlantRecord(pl, p);
+
+    // Species: bitmap of changed previous entries, then changed + new records
+    bool incremental = speciesIsPrefix(prev, cur);
+    if (incremental) {
+        std::vector<uint8_t> spBits((prev.species.size() + 7) / 8, 0);
+        ByteWriter spRecs;
+        for (size_t k = 0; k < prev.species.size(); k++) {
+            if (sameSpeciesRecord(prev.species[k], cur.species[k])) continue;
+            spBits[k >> 3] |= (uint8_t)(1u << (k & 7));
+            writeSpeciesRecord(spRecs, cur.species[k]);
+        }
+        for (size_t k = prev.species.size(); k < cur.species.size(); k++)
+            writeSpeciesRecord(spRecs, cur.species[k]);
+        sp.write(spBits.data(), spBits.size());
+        sp.write(spRecs.bytes.data(), spRecs.size());
+    } else {
+        for (const auto& x : cur.species) writeSpeciesRecord(sp, x);
+    }
+
+    ByteWriter meta;
+    meta.writeF(cur.simTime);
+    meta.writeU32(cur.nextID);
+    meta.writeU32(cur.nextSpeciesID);
+    meta.writeU32((uint32_t)prev.creatures.size());
+    meta.writeU32(survivors);
+    meta.writeU32((uint32_t)(removed.size() / sizeof(uint32_t)));
+    meta.writeU32((uint32_t)(added.size() / CREATURE_RECORD_BYTES));
+    meta.writeU32((uint32_t)cur.plants.size());
+    meta.writeU32((uint32_t)cur.species.size());
+    meta.writeU8(incremental ? 1 : 0);
+    meta.writeU64(cur.tickCount);
+
+    putBlock(out, meta, 1, raw);
+    putBlock(out, removed, sizeof(uint32_t), raw);
+    putBlock(out, bitmap, 1, raw);
+    putBlock(out, changes, MUTABLE_BYTES, raw);
+    putBlock(out, added, CREATURE_RECORD_BYTES, raw);
+    putBlock(out, pl, PLANT_RECORD_BYTES, raw);
+    putBlock(out, sp, 1, raw);
+}
+
+// ── Decoders ──────────────────────────────────────────────────────────────────
+static bool decodePlantsSpecies(const uint8_t* data, size_t size, size_t& pos,
+                                uint32_t nPlants, uint32_t nSpecies, WorldSnapshot& s) {
+    std::vector<uint8_t> blk;
+    if (!getBlock(data, size, pos, blk)) return false;
+    if (blk.size() != (size_t)nPlants * PLANT_RECORD_BYTES) return false;
+    ByteReader pr(blk.data(), blk.size());
+    s.plants.resize(nPlants);
+    for (auto& p : s.plants) readPlantRecord(pr, p);
+
+    if (!getBlock(data, size, pos, blk)) return false;
+    if ((uint64_t)nSpecies * SPECIES_RECORD_MIN_BYTES > blk.size()) return false;
+    ByteReader sr(blk.data(), blk.size());
+    s.species.resize(nSpecies);
+    for (auto& x : s.species) readSpeciesRecord(sr, x);
+    return pr.ok && sr.ok;
+}
+
+static bool decodeBase(const uint8_t* data, size_t size, WorldSnapshot& s) {
+    size_t pos = 0;
+    std::vector<uint8_t> blk;
+    if (!getBlock(data, size, pos, blk)) return false;
+    ByteReader m(blk.data(), blk.size());
+    s.simTime         = m.readF();
+    s.nextID          = m.readU32();
+    s.nextSpeciesID   = m.readU32();
+    uint32_t nC = m.readU32(), nP = m.readU32(), nS = m.readU32();
+    s.tickCount       = m.remaining() >= 8 ? m.readU64() : 0;   // absent in older chains
+    if (!m.ok) return false;
+
+    if (!getBlock(data, size, pos, blk)) return false;
+    if (blk.size() != (size_t)nC * CREATURE_RECORD_BYTES) return false;
+    ByteReader cr(blk.data(), blk.size());
+    s.creatures.resize(nC);
+    for (auto& c : s.creatures) readCreatureRecord(cr, c);
+
+    return decodePlantsSpecies(data, size, pos, nP, nS, s);
+}
+
+// Apply a delta in place: `s` must hold the state of the preceding record.
+static bool applyDelta(const uint8_t* data, size_t size, WorldSnapshot& s) {
+    size_t pos = 0;
+    std::vector<uint8_t> meta, removed, bitmap, changes, added;
+    if (!getBlock(data, size, pos, meta)) return false;
+    ByteReader m(meta.data(), meta.size());
+    float    simTime   = m.readF();
+    uint32_t nextID    = m.readU32();
+    uint32_t nextSp    = m.readU32();
+    uint32_t prevCount = m.readU32();
+    uint32_t survivors = m.readU32();
+    uint32_t nRemoved  = m.readU32();
+    uint32_t nAdded    = m.readU32();
+    uint32_t nP = m.readU32(), nS = m.readU32();
+    bool     spIncremental = m.readU8() != 0;
+    uint64_t tickCount     = m.remaining() >= 8 ? m.readU64() : 0;   // absent in older chains
+    if (!m.ok || prevCount != s.creatures.size()) return false;   // wrong base
+
+    if (!getBlock(data, size, pos, removed) || !getBlock(data, size, pos, bitmap) ||
+        !getBlock(data, size, pos, changes) || !getBlock(data, size, pos, added))
+        return false;
+    if (removed.size() != nRemoved * sizeof(uint32_t) ||
+        added.size()   != (size_t)nAdded * CREATURE_RECORD_BYTES ||
+        bitmap.size()  != (survivors + 7) / 8)
+        return false;
+
+    // Drop dead creatures and XOR changed survivors, preserving id order
+    std::vector<Creature> next;
+    next.reserve(survivors + nAdded);
+    const uint32_t* dead = reinterpret_cast<const uint32_t*>(removed.data());
+    size_t d = 0, ch = 0;
+    uint32_t sIdx = 0;
+    uint32_t w[MUTABLE_WORDS], x[MUTABLE_WORDS];
+    for (const auto& c : s.creatures) {
+        uint32_t deadID = 0;
+        if (d < nRemoved) std::memcpy(&deadID, dead + d, sizeof(deadID));
+        if (d < nRemoved && deadID == c.id) { d++; continue; }
+        if (sIdx >= survivors) return false;
+        next.push_back(c);
+        if (bitmap[sIdx >> 3] & (1u << (sIdx & 7))) {
+            if ((ch + 1) * MUTABLE_BYTES > changes.size()) return false;
+            packMutable(c, w);
+            std::memcpy(x, changes.data() + ch * MUTABLE_BYTES, MUTABLE_BYTES);
+            for (int k = 0; k < MUTABLE_WORDS; k++) w[k] ^= x[k];
+            unpackMutable(w, next.back());
+            ch++;
+        }
+        sIdx++;
+    }
+    if (sIdx != survivors || d != nRemoved) return false;
+
+    ByteReader ar(added.data(), added.size());
+    for (uint32_t k = 0; k < nAdded; k++) {
+        next.emplace_back();
+        readCreatureRecord(ar, next.back());
+    }
+
+    s.creatures.swap(next);
+    s.simTime       = simTime;
+    s.tickCount     = tickCount;
+    s.nextID        = nextID;
+    s.nextSpeciesID = nextSp;
+    if (!spIncremental) return decodePlantsSpecies(data, size, pos, nP, nS, s);
+
+    // Plants in full, species as changed-bitmap + changed/new records
+    std::vector<uint8_t> blk;
+    if (!getBlock(data, size, pos, blk)) return false;
+    if (blk.size() != (size_t)nP * PLANT_RECORD_BYTES) return false;
+    ByteReader pr(blk.data(), blk.size());
+    s.plants.resize(nP);
+    for (auto& p : s.plants) readPlantRecord(pr, p);
+
+    if (!getBlock(data, size, pos, blk)) return false;
+    size_t prevSp = s.species.size();
+    size_t bitBytes = (prevSp + 7) / 8;
+    if (nS < prevSp || blk.size() < bitBytes ||
+        (uint64_t)(nS - prevSp) * SPECIES_RECORD_MIN_BYTES > blk.size() - bitBytes)
+        return false;
+    ByteReader sr(blk.data() + bitBytes, blk.size() - bitBytes);
+    s.species.resize(nS);
+    for (size_t k = 0; k < nS; k++) {
+        bool changed = k >= prevSp || (blk[k >> 3] & (1u << (k & 7)));
+        if (changed) readSpeciesRecord(sr, s.species[k]);
+    }
+    return pr.ok && sr.ok;
+}
+
+// ── Stand-alone compressed states ─────────────────────────────────────────────
+size_t compressSnapshot(const WorldSnapshot& snap, std::vector<uint8_t>& out) {
+    size_t raw = 0;
+    out.clear();
+    encodeBase(snap, out, raw);
+    return raw;
+}
+
+bool decompressSnapshot(const uint8_t* data, size_t size, WorldSnapshot& out) {
+    return decodeBase(data, size, out);
+}
+
+// ── CheckpointWriter ──────────────────────────────────────────────────────────
+bool CheckpointWriter::append(const WorldSnapshot& snap, const std::string& path,
+                              CheckpointEntry* outEntry) {
+    TRACE_SCOPE("Checkpoint append");
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    bool fresh = !fs::exists(path, ec) || fs::file_size(path, ec) < 8;
+
+    // Cut a torn tail (a crash mid-append) back to the last complete record,
+    // so the new record lands where the reader will look for it
+    uint64_t offset = 8;
+    bool     torn   = false;
+    if (!fresh) {
+        std::vector<CheckpointEntry> entries;
+        if (!listCheckpoints(path, entries)) return false;   // not a chain we can extend
+        if (!entries.empty())
+            offset = entries.back().offset + RECORD_HEADER_LEN + entries.back().payloadBytes;
+        if (fs::file_size(path, ec) != offset) {
+            fs::resize_file(path, offset, ec);
+            if (ec) return false;
+            torn = true;
+        }
+    }
+
+    WorldSnapshot cur;
+    aliveOnly(snap, cur);
+
+    bool base = fresh || torn || chainPath != path || sinceBase >= baseInterval - 1;
+    std::vector<uint8_t> payload;
+    size_t raw = 0;
+    if (base) encodeBase(cur, payload, raw);
+    else      encodeDelta(prev, cur, payload, raw);
+
+    std::FILE* f = std::fopen(path.c_str(), fresh ? "wb" : "ab");
+    if (!f) return false;
+    ByteWriter hdr;
+    if (fresh) {
+        hdr.write("EVOC", 4);
+        hdr.writeU32(CHAIN_VERSION);
+    }
+    hdr.writeU8(base ? 0 : 1);
+    hdr.writeU8(0); hdr.writeU8(0); hdr.writeU8(0);
+    hdr.writeU32((uint32_t)payload.size());
+    hdr.writeU32((uint32_t)raw);
+    hdr.writeF(cur.simTime);
+    hdr.writeU32((uint32_t)cur.creatures.size());
+
+    bool ok = std::fwrite(hdr.bytes.data(), 1, hdr.size(), f) == hdr.size()
+           && std::fwrite(payload.data(), 1, payload.size(), f) == payload.size()
+           && syncFile(f);
+    ok = (std::fclose(f) == 0) && ok;
+    if (!ok) {
+        // Drop whatever part of the record made it out; the next append
+        // starts a clean base
+        if (fresh) fs::remove(path, ec);
+        else       fs::resize_file(path, offset, ec);
+        reset();
+        return false;
+    }
+
+    chainPath = path;
+    sinceBase = base ? 0 : sinceBase + 1;
+    prev.creatures.swap(cur.creatures);
+    prev.plants.swap(cur.plants);
+    prev.species.swap(cur.species);
+    prev.simTime       = cur.simTime;
+    prev.tickCount     = cur.tickCount;
+    prev.nextID        = cur.nextID;
+    prev.nextSpeciesID = cur.nextSpeciesID;
+
+    if (outEntry) {
+        outEntry->offset        = offset;
+        outEntry->isBase        = base;
+        outEntry->simTime       = prev.simTime;
+        outEntry->creatureCount = (uint32_t)prev.creatures.size();
+        outEntry->payloadBytes  = (uint32_t)payload.size();
+        outEntry->rawBytes      = (uint32_t)raw;
+    }
+    return true;
+}
+
+// ── Reader ────────────────────────────────────────────────────────────────────
+bool listCheckpoints(const std::string& path, std::vector<CheckpointEntry>& out) {
+    out.clear();
+    std::ifstream f(path, std::ios::binary);
+    if (!f) return false;
+
+    char magic[4] = {};
+    uint32_t version = 0;
+    f.read(magic, 4);
+    f.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!f || std::strncmp(magic, "EVOC", 4) != 0 || version != CHAIN_VERSION) return false;
+
+    std::error_code ec;
+    uint64_t fileSize = std::filesystem::file_size(path, ec);
+    uint64_t offset   = 8;
+    uint8_t  hdr[RECORD_HEADER_LEN];
+    while (offset + RECORD_HEADER_LEN <= fileSize) {
+        f.seekg((std::streamoff)offset);
+        if (!f.read(reinterpret_cast<char*>(hdr), RECORD_HEADER_LEN)) break;
+        ByteReader r(hdr, RECORD_HEADER_LEN);
+        CheckpointEntry e;
+        e.offset        = offset;
+        e.isBase        = r.readU8() == 0;
+        r.skip(3);
+        e.payloadBytes  = r.readU32();
+        e.rawBytes      = r.readU32();
+        e.simTime       = r.readF();
+        e.creatureCount = r.readU32();
+        if (offset + RECORD_HEADER_LEN + e.payloadBytes > fileSize) break;   // torn tail
+        out.push_back(e);
+        offset += RECORD_HEADER_LEN + e.payloadBytes;
+    }
+    return true;
+}
+
+bool loadCheckpoint(const std::string& path, int index, WorldSnapshot& out) {
+    std::vector<CheckpointEntry> entries;
+    if (!listCheckpoints(path, entries) || entries.empty()) return false;
+    if (index < 0 || index >= (int)entries.size()) index = (int)entries.size() - 1;
+
+    int baseIdx = index;
+    while (baseIdx > 0 && !entries[baseIdx].isBase) baseIdx--;
+    if (!entries[baseIdx].isBase) return false;
+
+    std::ifstream f(path, std::ios::binary);
+    if (!f) return false;
+    std::vector<uint8_t> payload;
+    for (int k = baseIdx; k <= index; k++) {
+        const CheckpointEntry& e = entries[k];
+        payload.resize(e.payloadBytes);
+        f.seekg((std::streamoff)(e.offset + RECORD_HEADER_LEN));
+        if (!f.read(reinterpret_cast<char*>(payload.data()), e.payloadBytes)) return false;
+        bool ok = (k == baseIdx) ? decodeBase(payload.data(), payload.size(), out)
+                                 : applyDelta(payload.data(), payload.size(), out);
+        if (!ok) return false;
+    }
+    return true;
+}
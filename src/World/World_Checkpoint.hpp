@@ -0,0 +1,78 @@
+#pragma once
+// ── World_Checkpoint.hpp ──────────────────────────────────────────────────────
+// Incremental checkpoint chains ("EVOC").
+//
+// A chain file holds a sequence of checkpoint records. A *base* record is a
+// complete world state; a *delta* record stores only what changed since the
+// previous record:
+//   • IDs of creatures that died
+//   • full records of creatures born since
+//   • for survivors, the mutable fields (pos, vel, yaw, needs, energy, age,
+//     behaviour) XOR'd against their previous values – unchanged creatures
+//     cost one bit, slowly changing ones compress to a few bytes
+//   • plants in full (small, and evicted plants shift every index)
+//   • species records that changed, plus newly formed species
+// Genomes, lineage and other identity fields of survivors are never rewritten.
+//
+// Every payload block goes through Compress (shuffle + delta + PackBits).
+// A new base is written every `baseInterval` checkpoints so restoring any entry
+// replays a bounded number of deltas. Records are appended and fsync'd; a torn
+// tail from a crash is ignored by the reader and cut off by the next append,
+// and a failed append truncates the chain back to its last complete record.
+//
+// File layout:
+//   [4] magic "EVOC"   [4] version uint32 = 1
+//   per record: kind uint8 (0 = base, 1 = delta), reserved uint8×3,
+//               payloadBytes uint32, rawBytes uint32,
+//               simTime float, creatureCount uint32,
+//               payload (a run of Compress blocks)
+// Each payload's first block holds the world scalars and counts, ending with
+// the tick counter (uint64); chains written before it was added end one field
+// short, and restore with the counter at 0.
+
+#include "World_Snapshot.hpp"
+#include <string>
+#include <vector>
+
+struct CheckpointEntry {
+    uint64_t offset        = 0;     // file offset of the record header
+    bool     isBase        = false;
+    float    simTime       = 0.f;
+    uint32_t creatureCount = 0;
+    uint32_t payloadBytes  = 0;     // compressed size on disk
+    uint32_t rawBytes      = 0;     // size before compression
+};
+
+// ── Writer ────────────────────────────────────────────────────────────────────
+// Stateful: remembers the last state it appended so the next checkpoint can be
+// a delta. Switching chain files (or a fresh process) starts with a base.
+struct CheckpointWriter {
+    int baseInterval = 24;   // checkpoints per base (1 = every record is a base)
+
+    // Append `snap` to the chain at `path`, creating the file if needed.
+    // Fails without writing if `path` exists but isn't a chain.
+    // On success `outEntry` (optional) describes the record written.
+    bool append(const WorldSnapshot& snap, const std::string& path,
+                CheckpointEntry* outEntry = nullptr);
+
+    void reset() { chainPath.clear(); prev = WorldSnapshot{}; sinceBase = 0; }
+
+private:
+    std::string   chainPath;   // chain that `prev` belongs to ("" = none)
+    WorldSnapshot prev;        // alive-only state as of the last record
+    int           sinceBase = 0;
+};
+
+// ── Stand-alone compressed states ─────────────────────────────────────────────
+// The payload of a base record without the chain around it; used by the rewind
+// ring to keep many full states in memory. Returns the uncompressed size.
+size_t compressSnapshot(const WorldSnapshot& snap, std::vector<uint8_t>& out);
+bool   decompressSnapshot(const uint8_t* data, size_t size, WorldSnapshot& out);
+
+// ── Reader ────────────────────────────────────────────────────────────────────
+// List all complete records in a chain (cheap: headers only).
+bool listCheckpoints(const std::string& path, std::vector<CheckpointEntry>& out);
+
+// Reconstruct the state at chain entry `index` (negative = latest) by decoding
+// the nearest preceding base and replaying the deltas after it.
+bool loadCheckpoint(const std::string& path, int index, WorldSnapshot& out);
@@ -0,0 +1,134 @@
+#include "World_Costs.hpp"
+#include "World.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+const char* costGroupName(int group) {
+    static const char* names[COST_GROUPS] = { "Behaviour", "Vision range", "Vision FOV", "Neighbours", "Species" };
+    return names[group];
+}
+
+static uint64_t nowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static int decileOf(float raw) {
+    return std::clamp((int)(raw * CostAttribution::DECILES), 0, CostAttribution::DECILES - 1);
+}
+
+static int neighbourBin(uint32_t n) {
+    int b = 0;
+    while (n && b < CostAttribution::NEIGHBOUR_BINS - 1) { n >>= 1; b++; }
+    return b;
+}
+
+// ── Accumulation ──────────────────────────────────────────────────────────────
+void CostAttribution::reset() {
+    tickCount = ticks = 0;
+    all = {};
+    for (auto& b : behavior)   b = {};
+    for (auto& b : vision)     b = {};
+    for (auto& b : fov)        b = {};
+    for (auto& b : neighbours) b = {};
+    species.clear();
+}
+
+bool CostAttribution::beginTick(size_t population) {
+    if (!enabled || tickCount++ % std::max<uint32_t>(every, 1) != 0) return false;
+    ticks++;
+    pending.assign(population, Pending{});
+    return true;
+}
+
+void CostAttribution::add(const Creature& c, const Pending& p, uint64_t actNs) {
+    all.add(p.perceiveNs, actNs);
+    behavior[(int)p.entered].add(p.perceiveNs, actNs);
+    vision[decileOf(c.genome.raw[GENE_VISION_RANGE])].add(p.perceiveNs, actNs);
+    fov[decileOf(c.genome.raw[GENE_VISION_FOV])].add(p.perceiveNs, actNs);
+    neighbours[neighbourBin(p.neighbours)].add(p.perceiveNs, actNs);
+    if (c.speciesID >= species.size()) species.resize(c.speciesID + 1);
+    species[c.speciesID].add(p.perceiveNs, actNs);
+}
+
+// ── Tables ────────────────────────────────────────────────────────────────────
+std::vector<CostAttribution::Row> CostAttribution::rows(int group, const World& world, size_t maxSpecies) const {
+    std::vector<Row> out;
+    char label[64];
+    switch (group) {
+        case COST_BEHAVIOR:
+            for (int b = 0; b < BEHAVIORS; b++)
+                out.push_back({ behaviorName((BehaviorState)b), behavior[b] });
+            break;
+        case COST_VISION:
+        case COST_FOV: {
+            const CostBin* bins = group == COST_VISION ? vision : fov;
+            bool  range = group == COST_VISION;
+            float lo = range ? Genome::VISION_RANGE_MIN : Genome::VISION_FOV_MIN;
+            float hi = range ? Genome::VISION_RANGE_MAX : Genome::VISION_FOV_MAX;
+            const char* unit = range ? "" : " deg";
+            for (int d = 0; d < DECILES; d++) {
+                std::snprintf(label, sizeof label, "%.0f-%.0f%s",
+                              lo + (hi - lo) * d / DECILES, lo + (hi - lo) * (d + 1) / DECILES, unit);
+                out.push_back({ label, bins[d] });
+            }
+            break;
+        }
+        case COST_NEIGHBOURS:
+            for (int b = 0; b < NEIGHBOUR_BINS; b++) {
+                uint32_t lo = b ? 1u << (b - 1) : 0u, hi = b ? (1u << b) - 1 : 0u;
+                if (b == NEIGHBOUR_BINS - 1) std::snprintf(label, sizeof label, "%u+", lo);
+                else if (lo == hi)           std::snprintf(label, sizeof label, "%u", lo);
+                else                         std::snprintf(label, sizeof label, "%u-%u", lo, hi);
+                out.push_back({ label, neighbours[b] });
+            }
+            break;
+        case COST_SPECIES: {
+            for (uint32_t id = 0; id < species.size(); id++) {
+                if (!species[id].samples) continue;
+                const SpeciesInfo* sp = world.getSpecies(id);
+                if (sp) out.push_back({ sp->name, species[id] });
+                else {
+                    std::snprintf(label, sizeof label, "#%u", id);
+                    out.push_back({ label, species[id] });
+                }
+            }
+            std::sort(out.begin(), out.end(),
+                      [](const Row& a, const Row& b) { return a.bin.totalNs() > b.bin.totalNs(); });
+            if (out.size() > maxSpecies) out.resize(maxSpecies);
+            break;
+        }
+    }
+    return out;
+}
+
+// ── Sampled passes ────────────────────────────────────────────────────────────
+// Same work as the plain loops in tick(), with each call timed on its own
+void World::perceiveSampled(float dt) {
+    for (size_t i = 0; i < creatures.size(); i++) {
+        Creature& c = creatures[i];
+        if (!c.alive) continue;
+        CostAttribution::Pending& p = costs.pending[i];
+        p.entered    = c.behavior;
+        uint64_t t0  = nowNs();
+        p.neighbours = perceive(c, dt);
+        p.perceiveNs = nowNs() - t0;
+        p.perceived  = true;
+    }
+}
+
+void World::actSampled(float dt, TickCounters& counters) {
+    for (size_t i = 0; i < creatures.size(); i++) {
+        Creature& c = creatures[i];
+        const CostAttribution::Pending& p = costs.pending[i];
+        // A creature killed earlier in this pass still cost its perception
+        uint64_t actNs = 0;
+        if (c.alive) {
+            uint64_t t0 = nowNs();
+            c.tick(dt, *this, counters);
+            actNs = nowNs() - t0;
+        }
+        if (p.perceived) costs.add(c, p, actNs);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+// ── World_Costs.hpp ───────────────────────────────────────────────────────────
+// Optional attribution of the perceive and act passes to the creatures that
+// cost them, for finding out which traits and states make a population slow.
+//
+// While enabled, one tick in `every` is sampled: each creature's perceive()
+// and Creature::tick() are timed on their own, and both times are added to
+// the bins the creature falls in – its behaviour entering the tick, its
+// vision-range and FOV gene deciles, the number of candidates the spatial
+// query handed perceive() (local density as perception sees it) and its
+// species. Unsampled ticks run the plain loops, so the cost when enabled is
+// two clock reads per creature every `every` ticks, and nothing when not.
+
+#include "../Sim/Creature.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct World;
+
+enum CostGroup : int {
+    COST_BEHAVIOR,     // behaviour entering the tick
+    COST_VISION,       // vision-range gene decile
+    COST_FOV,          // vision-FOV gene decile
+    COST_NEIGHBOURS,   // spatial-query candidates (the creature included), power-of-two bins
+    COST_SPECIES,      // top species by total cost
+    COST_GROUPS
+};
+
+const char* costGroupName(int group);
+
+struct CostBin {
+    uint64_t samples    = 0;   // creature-ticks
+    uint64_t perceiveNs = 0;
+    uint64_t actNs      = 0;
+
+    uint64_t totalNs() const { return perceiveNs + actNs; }
+    void add(uint64_t p, uint64_t a) { samples++; perceiveNs += p; actNs += a; }
+};
+
+struct CostAttribution {
+    static constexpr int BEHAVIORS       = (int)BehaviorState::Socializing + 1;
+    static constexpr int DECILES         = 10;
+    static constexpr int NEIGHBOUR_BINS  = 10;   // 0, 1, 2–3, 4–7, ..., 256+
+
+    bool     enabled = false;
+    uint32_t every   = 16;   // sample one tick in this many
+
+    // One row of a table: the bin's label and its totals
+    struct Row {
+        std::string label;
+        CostBin     bin;
+    };
+
+    // Rows of one group, in bin order; COST_SPECIES is sorted by total cost
+    // and cut to `maxSpecies`, named from `world`'s registry
+    std::vector<Row> rows(int group, const World& world, size_t maxSpecies = 16) const;
+
+    const CostBin& overall() const { return all; }
+    uint64_t sampledTicks() const  { return ticks; }
+    void reset();
+
+private:
+    friend struct World;
+
+    // Per-creature scratch for the sampled tick, by index in World::creatures
+    struct Pending {
+        uint64_t      perceiveNs = 0;
+        uint32_t      neighbours = 0;
+        BehaviorState entered    = BehaviorState::Idle;
+        bool          perceived  = false;
+    };
+
+    uint64_t tickCount = 0;   // ticks seen while enabled
+    uint64_t ticks     = 0;   // ticks sampled
+    CostBin  all;
+    CostBin  behavior[BEHAVIORS];
+    CostBin  vision[DECILES];
+    CostBin  fov[DECILES];
+    CostBin  neighbours[NEIGHBOUR_BINS];
+    std::vector<CostBin> species;   // by species ID
+    std::vector<Pending> pending;
+
+    // True if this tick is to be sampled; sizes the scratch for `population`
+    bool beginTick(size_t population);
+    void add(const Creature& c, const Pending& p, uint64_t actNs);
+};
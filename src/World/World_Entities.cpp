@@ -15,9 +15,11 @@ Creature& World::spawnCreature(const Genome& g, const Vec3& pos,
     c.generation = gen;
     c.genome     = g;
     c.speciesID  = classifySpecies(g);  // assign to nearest existing species or create new one
-    c.initFromGenome(pos);
+    CounterRNG rng = rngFor(c.id, RNG_SPAWN);
+    c.initFromGenome(pos, rng);
 
     idToIndex[c.id] = creatures.size() - 1;
+    events.births++;
     return c;
 }
 
@@ -30,18 +32,39 @@ Plant& World::spawnPlant(const Vec3& pos, uint8_t type) {
     return p;
 }
 
-// Compact the creatures vector, removing all dead entries.
-// After removal, rebuilds idToIndex so all EntityID→index mappings are valid.
+// Compact the creatures vector, removing all dead entries, and keep idToIndex
+// valid. Only creatures behind the first dead one move, so only their entries
+// are updated (rebuilding the map would re-allocate every node every tick).
 // Called once per tick after all creature updates so we never read stale indices
 // during the tick itself.
 void World::removeDeadCreatures() {
-    creatures.erase(
-        std::remove_if(creatures.begin(), creatures.end(),
-                       [](const Creature& c){ return !c.alive; }),
-        creatures.end());
-    idToIndex.clear();
-    for (size_t i = 0; i < creatures.size(); i++)
-        idToIndex[creatures[i].id] = i;
+    size_t n   = creatures.size();
+    size_t out = 0;
+    while (out < n && creatures[out].alive) out++;
+    if (out == n) return;
+
+    for (size_t i = out; i < n; i++) {
+        if (!creatures[i].alive) {
+            idToIndex.erase(creatures[i].id);
+            continue;
+        }
+        creatures[out] = creatures[i];
+        idToIndex[creatures[out].id] = out;
+        out++;
+    }
+    events.deaths += n - out;
+    creatures.erase(creatures.begin() + out, creatures.end());
+}
+
+const char* deathCauseName(DeathCause c) {
+    switch (c) {
+        case DeathCause::Aging:       return "Aging";
+        case DeathCause::Starvation:  return "Starvation";
+        case DeathCause::Dehydration: return "Dehydration";
+        case DeathCause::Health:      return "Poor health";
+        case DeathCause::Predation:   return "Predation";
+        default:                      return "?";
+    }
 }
 
 // ── Spatial hash ──────────────────────────────────────────────────────────────
@@ -130,12 +153,12 @@ void World::growPlants(float dt) {
     const int cap = 3000;
     if (alive < cap) {
         // Integer portion always spawns; fractional part spawns with its probability
+        CounterRNG rng = rngFor(0, RNG_PLANTS);
         int toSpawn = (int)(cfg.plantGrowRate * dt)
-                    + (globalRNG().chance(cfg.plantGrowRate * dt
-                                         - (int)(cfg.plantGrowRate * dt)) ? 1 : 0);
-        RNG& rng = globalRNG();
+                    + (rng.chance(cfg.plantGrowRate * dt
+                                  - (int)(cfg.plantGrowRate * dt)) ? 1 : 0);
         for (int i = 0; i < toSpawn; i++) {
-            Vec3 pos = g_planet_surface.randomLandPos(globalRNG());
+            Vec3 pos = g_planet_surface.randomLandPos(rng);
             spawnPlant(pos);
         }
     }
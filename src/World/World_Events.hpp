@@ -0,0 +1,75 @@
+#pragma once
+// ── World_Events.hpp ──────────────────────────────────────────────────────────
+// Typed simulation events for the UI and other observers.
+//
+// The simulation publishes an event at the point where it already knows what
+// happened – classifySpecies() forming a species, the centroid pass finding
+// one empty, the end of tick() crossing a population threshold – so no
+// observer ever scans the population to detect them. Events travel through a
+// lock-free single-producer/single-consumer ring: World::tick() (on whatever
+// thread runs the simulation) is the only producer, and one consumer (SimUI)
+// drains it each frame. If the consumer falls behind, new events are dropped
+// and counted rather than blocking the simulation.
+
+#include "Core/SpscQueue.hpp"
+#include <atomic>
+#include <cstdint>
+
+enum class SimEventType : uint8_t {
+    SpeciesFormed,        // speciesID = the new species
+    SpeciesExtinct,       // speciesID; count = members it ever had
+    PopulationLow,        // count = population; fell below the low threshold
+    PopulationRecovered,  // count = population; back above the recovery threshold
+    PopulationBoom,       // count = population, limit = maxPopulation; reached the boom fraction of the cap
+    MassDieOff,           // count = deaths, limit = population at window start, over `window` seconds
+};
+
+inline const char* simEventName(SimEventType t) {
+    switch (t) {
+        case SimEventType::SpeciesFormed:       return "species formed";
+        case SimEventType::SpeciesExtinct:      return "species extinct";
+        case SimEventType::PopulationLow:       return "population low";
+        case SimEventType::PopulationRecovered: return "population recovered";
+        case SimEventType::PopulationBoom:      return "population boom";
+        case SimEventType::MassDieOff:          return "mass die-off";
+    }
+    return "?";
+}
+constexpr int SIM_EVENT_TYPES = (int)SimEventType::MassDieOff + 1;
+
+struct SimEvent {
+    SimEventType type      = SimEventType::SpeciesFormed;
+    float        simTime   = 0.f;
+    uint32_t     speciesID = 0;
+    uint32_t     count     = 0;
+    uint32_t     limit     = 0;
+    float        window    = 0.f;
+};
+
+// Thresholds for the population events; crossings use hysteresis so a
+// population hovering at a threshold produces one event, not one per tick
+struct SimEventConfig {
+    uint32_t lowPopulation      = 100;    // PopulationLow below this (and above zero)
+    uint32_t recoverPopulation  = 120;    // PopulationRecovered at or above this, once low
+    float    boomFraction       = 0.9f;   // PopulationBoom at this fraction of maxPopulation
+    float    dieOffWindow       = 10.f;   // sim seconds per die-off measurement window
+    float    dieOffFraction     = 0.25f;  // MassDieOff when a window kills this share
+    uint32_t dieOffMinDeaths    = 20;     // ... and at least this many
+};
+
+struct SimEventBus {
+    static constexpr size_t CAPACITY = 4096;
+
+    // Producer (simulation thread)
+    void publish(const SimEvent& e) {
+        if (!queue.push(e)) dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Consumer (UI thread)
+    bool poll(SimEvent& out) { return queue.pop(out); }
+    uint64_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    SpscQueue<SimEvent, CAPACITY> queue;
+    std::atomic<uint64_t>         dropped{0};
+};
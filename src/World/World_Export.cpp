@@ -0,0 +1,215 @@
+#include "World_Export.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+const char* csvColumnGroupName(CsvColumns group) {
+    switch (group) {
+        case CSV_ID:           return "ID";
+        case CSV_SPECIES:      return "Species ID";
+        case CSV_POSITION:     return "Position";
+        case CSV_AGE_ENERGY:   return "Age / Energy";
+        case CSV_TRAITS:       return "Key Traits";
+        case CSV_LINEAGE:      return "Lineage";
+        case CSV_SPECIES_NAME: return "Species Name";
+        case CSV_BODY:         return "Body";
+        case CSV_BEHAVIOR:     return "Behaviour";
+        case CSV_NEEDS:        return "Needs";
+        case CSV_GENOME:       return "Full Genome";
+        default:               return "??";
+    }
+}
+
+// ── Row formatting ────────────────────────────────────────────────────────────
+// Appends fields to a growable char buffer. Every field is preceded by a comma
+// except the first on the row.
+struct CsvRow {
+    std::vector<char>& out;
+    bool first = true;
+
+    char* reserve(size_t n) {
+        size_t at = out.size();
+        out.resize(at + n + 1);
+        char* p = out.data() + at;
+        if (!first) *p++ = ',';
+        first = false;
+        return p;
+    }
+    void commit(char* end) { out.resize(end - out.data()); }
+
+    void u32(uint32_t v) {
+        char* p = reserve(10);
+        commit(std::to_chars(p, p + 10, v).ptr);
+    }
+    void f32(float v) {
+        char* p = reserve(24);   // shortest round-trip float never exceeds 15 chars
+        commit(std::to_chars(p, p + 24, v).ptr);
+    }
+    void str(const char* s, size_t n) {
+        char* p = reserve(n);
+        std::copy(s, s + n, p);
+        commit(p + n);
+    }
+    void str(const char* s) { str(s, std::char_traits<char>::length(s)); }
+    void end() { out.push_back('\n'); first = true; }
+};
+
+static void writeHeader(uint32_t cols, std::vector<char>& out) {
+    std::string h;
+    auto add = [&](const std::string& name) { if (!h.empty()) h += ','; h += name; };
+    if (cols & CSV_ID)           add("id");
+    if (cols & CSV_SPECIES)      add("species");
+    if (cols & CSV_POSITION)     { add("x"); add("y"); add("z"); }
+    if (cols & CSV_AGE_ENERGY)   { add("age"); add("energy"); }
+    if (cols & CSV_TRAITS)       { add("speed"); add("herbEff"); add("carnEff"); }
+    if (cols & CSV_LINEAGE)      { add("parentA"); add("parentB"); add("generation"); }
+    if (cols & CSV_SPECIES_NAME) add("speciesName");
+    if (cols & CSV_BODY)         { add("mass"); add("maxEnergy"); add("lifespan");
+                                   add("vx"); add("vy"); add("vz"); add("yaw"); }
+    if (cols & CSV_BEHAVIOR)     { add("behavior"); add("activeDrive");
+                                   add("gestTimer"); add("mateTarget"); }
+    if (cols & CSV_NEEDS)
+        for (int d = 0; d < DRIVE_COUNT; d++) add(std::string("need_") + driveName((Drive)d));
+    if (cols & CSV_GENOME)
+        for (int g = 0; g < GENOME_SIZE; g++) add(std::string("gene_") + geneName(g));
+    h += '\n';
+    out.assign(h.begin(), h.end());
+}
+
+static void formatRow(const Creature& c, uint32_t cols,
+                      const std::vector<const std::string*>& nameById, CsvRow& r) {
+    if (cols & CSV_ID)           r.u32(c.id);
+    if (cols & CSV_SPECIES)      r.u32(c.speciesID);
+    if (cols & CSV_POSITION)     { r.f32(c.pos.x); r.f32(c.pos.y); r.f32(c.pos.z); }
+    if (cols & CSV_AGE_ENERGY)   { r.f32(c.age); r.f32(c.energy); }
+    if (cols & CSV_TRAITS)       { r.f32(c.genome.maxSpeed());
+                                   r.f32(c.genome.herbEfficiency());
+                                   r.f32(c.genome.carnEfficiency()); }
+    if (cols & CSV_LINEAGE)      { r.u32(c.parentA); r.u32(c.parentB); r.u32(c.generation); }
+    if (cols & CSV_SPECIES_NAME) {
+        const std::string* n = c.speciesID < nameById.size() ? nameById[c.speciesID] : nullptr;
+        if (n) r.str(n->data(), n->size()); else r.str("", 0);
+    }
+    if (cols & CSV_BODY)         { r.f32(c.mass); r.f32(c.maxEnergy); r.f32(c.lifespan);
+                                   r.f32(c.vel.x); r.f32(c.vel.y); r.f32(c.vel.z); r.f32(c.yaw); }
+    if (cols & CSV_BEHAVIOR)     { r.str(behaviorName(c.behavior));
+                                   r.str(driveName(c.needs.activeDrive()));
+                                   r.f32(c.gestTimer); r.u32(c.mateTarget); }
+    if (cols & CSV_NEEDS)
+        for (int d = 0; d < DRIVE_COUNT; d++) r.f32(c.needs.urgency[d]);
+    if (cols & CSV_GENOME)
+        for (int g = 0; g < GENOME_SIZE; g++) r.f32(c.genome.raw[g]);
+    r.end();
+}
+
+// ── Parallel export ───────────────────────────────────────────────────────────
+bool exportCreaturesCSV(const std::vector<Creature>& creatures,
+                        const std::vector<SpeciesInfo>& species,
+                        const std::string& path,
+                        const CsvExportOptions& opt,
+                        CsvExportStats* stats) {
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+
+    std::FILE* f = std::fopen(path.c_str(), opt.append ? "ab" : "wb");
+    if (!f) return false;
+
+    // Species ids are small and dense; a flat table beats a map in the hot loop
+    std::vector<const std::string*> nameById;
+    if (opt.columns & CSV_SPECIES_NAME) {
+        for (const auto& sp : species) {
+            if (sp.id >= nameById.size()) nameById.resize(sp.id + 1, nullptr);
+            nameById[sp.id] = &sp.name;
+        }
+    }
+
+    const size_t n         = creatures.size();
+    const size_t chunkRows = std::max<size_t>(opt.chunkRows, 64);
+    const size_t nChunks   = (n + chunkRows - 1) / chunkRows;
+    int threads = opt.threads > 0 ? opt.threads : (int)std::thread::hardware_concurrency();
+    threads = std::clamp(threads, 1, (int)std::max<size_t>(nChunks, 1));
+    const size_t window = (size_t)threads * 2;   // chunks formatted ahead of the writer
+
+    struct Slot { std::vector<char> buf; size_t rows = 0; bool ready = false; };
+    std::vector<Slot>       slots(window);
+    std::atomic<size_t>     nextChunk{0};
+    std::mutex              mtx;
+    std::condition_variable cvReady, cvFree;
+    size_t                  writtenChunks = 0;   // guarded by mtx
+
+    auto formatChunk = [&](size_t k, Slot& s) {
+        s.buf.clear();
+        s.rows = 0;
+        CsvRow row{s.buf};
+        size_t end = std::min(n, (k + 1) * chunkRows);
+        for (size_t i = k * chunkRows; i < end; i++) {
+            if (opt.aliveOnly && !creatures[i].alive) continue;
+            formatRow(creatures[i], opt.columns, nameById, row);
+            s.rows++;
+        }
+    };
+
+    auto worker = [&]() {
+        for (;;) {
+            size_t k = nextChunk.fetch_add(1);
+            if (k >= nChunks) return;
+            Slot& s = slots[k % window];
+            {
+                // Wait until the writer has drained the chunk that used this slot
+                std::unique_lock<std::mutex> lock(mtx);
+                cvFree.wait(lock, [&]{ return k < writtenChunks + window; });
+            }
+            formatChunk(k, s);
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                s.ready = true;
+            }
+            cvReady.notify_all();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    if (threads > 1)
+        for (int t = 0; t < threads; t++) pool.emplace_back(worker);
+
+    std::vector<char> header;
+    if (opt.header) writeHeader(opt.columns, header);
+    bool   ok    = std::fwrite(header.data(), 1, header.size(), f) == header.size();
+    size_t bytes = header.size(), rows = 0;
+
+    // The calling thread writes chunks in row order. With a single thread it
+    // formats them itself, so the sequential path has no synchronisation.
+    for (size_t k = 0; k < nChunks; k++) {
+        Slot& s = slots[k % window];
+        if (threads == 1) {
+            formatChunk(k, s);
+        } else {
+            std::unique_lock<std::mutex> lock(mtx);
+            cvReady.wait(lock, [&]{ return s.ready; });
+        }
+        ok = ok && std::fwrite(s.buf.data(), 1, s.buf.size(), f) == s.buf.size();
+        bytes += s.buf.size();
+        rows  += s.rows;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            s.ready = false;
+            writtenChunks++;
+        }
+        cvFree.notify_all();
+    }
+    for (auto& t : pool) t.join();
+    ok = (std::fclose(f) == 0) && ok;
+
+    if (stats) {
+        stats->rows    = rows;
+        stats->bytes   = bytes;
+        stats->threads = threads;
+        stats->seconds = std::chrono::duration<double>(Clock::now() - t0).count();
+    }
+    return ok;
+}
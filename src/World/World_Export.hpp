@@ -0,0 +1,59 @@
+#pragma once
+// ── World_Export.hpp ──────────────────────────────────────────────────────────
+// High-throughput creature CSV export.
+//
+// Rows are split into chunks; worker threads format chunks with std::to_chars
+// (locale-independent, shortest round-trip floats) into private buffers, and
+// the calling thread writes finished chunks in row order with large fwrites.
+// At most a small window of chunks is in flight, so memory stays bounded no
+// matter how many creatures are exported.
+//
+// Columns are chosen as groups; they always appear in the order listed below.
+// CSV_DEFAULT reproduces the original exportCSV layout:
+//   id,species,x,y,z,age,energy,speed,herbEff,carnEff
+
+#include "World.hpp"
+#include <string>
+#include <vector>
+
+enum CsvColumns : uint32_t {
+    CSV_ID           = 1u << 0,   // id
+    CSV_SPECIES      = 1u << 1,   // species (id)
+    CSV_POSITION     = 1u << 2,   // x, y, z
+    CSV_AGE_ENERGY   = 1u << 3,   // age, energy
+    CSV_TRAITS       = 1u << 4,   // speed, herbEff, carnEff (derived from the genome)
+    CSV_LINEAGE      = 1u << 5,   // parentA, parentB, generation
+    CSV_SPECIES_NAME = 1u << 6,   // speciesName
+    CSV_BODY         = 1u << 7,   // mass, maxEnergy, lifespan, velocity, yaw
+    CSV_BEHAVIOR     = 1u << 8,   // behavior, activeDrive, gestTimer, mateTarget
+    CSV_NEEDS        = 1u << 9,   // need_<Drive> urgency for every drive
+    CSV_GENOME       = 1u << 10,  // gene_<Name> raw [0,1] value for every gene
+
+    CSV_DEFAULT = CSV_ID | CSV_SPECIES | CSV_POSITION | CSV_AGE_ENERGY | CSV_TRAITS,
+    CSV_ALL     = (1u << 11) - 1,
+};
+
+// Display name of a single column group (for UI checkboxes)
+const char* csvColumnGroupName(CsvColumns group);
+
+struct CsvExportOptions {
+    uint32_t columns   = CSV_DEFAULT;
+    int      threads   = 0;      // 0 = hardware concurrency
+    size_t   chunkRows = 4096;   // rows formatted per work item
+    bool     aliveOnly = true;
+    bool     header    = true;   // write the column header line
+    bool     append    = false;  // append to `path` instead of truncating it
+};
+
+struct CsvExportStats {
+    size_t rows    = 0;
+    size_t bytes   = 0;
+    double seconds = 0.0;
+    int    threads = 0;
+};
+
+bool exportCreaturesCSV(const std::vector<Creature>& creatures,
+                        const std::vector<SpeciesInfo>& species,
+                        const std::string& path,
+                        const CsvExportOptions& opt = {},
+                        CsvExportStats* stats = nullptr);
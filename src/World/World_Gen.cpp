@@ -56,5 +56,8 @@ void World::reset() {
     nextID       = 1;
     nextSpeciesID= 1;
     simTime      = 0.f;
+    tickCount    = 0;
+    speciesTimer = 0.f;
+    costs.reset();   // species IDs start over
     generate(seed, worldCX, worldCZ);
 }
\ No newline at end of file
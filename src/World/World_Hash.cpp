@@ -0,0 +1,155 @@
+#include "World_Hash.hpp"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+// Word-at-a-time multiply-xorshift mixing; order-sensitive
+struct Hasher {
+    uint64_t h = 0x243f6a8885a308d3ull;
+
+    void word(uint64_t v) {
+        h ^= v;
+        h *= 0x9e3779b97f4a7c15ull;
+        h ^= h >> 29;
+    }
+    void f32(float v) {
+        uint32_t b;
+        std::memcpy(&b, &v, sizeof(b));
+        word(b);
+    }
+    void vec(const Vec3& v) { f32(v.x); f32(v.y); f32(v.z); }
+    void floats(const float* v, size_t n) { for (size_t i = 0; i < n; i++) f32(v[i]); }
+    void str(const std::string& s) {
+        word(s.size());
+        for (char c : s) word((uint8_t)c);
+    }
+    uint64_t finish() const {
+        uint64_t x = h;
+        x ^= x >> 33; x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33; x *= 0xc4ceb9fe1a85ec53ull;
+        return x ^ (x >> 33);
+    }
+};
+
+void hashCreature(Hasher& hs, const Creature& c, int field) {
+    switch (field) {
+        case WH_CREATURE_IDENTITY:
+            hs.word(c.id); hs.word(c.parentA); hs.word(c.parentB);
+            hs.word(c.generation); hs.word(c.speciesID); hs.word(c.alive);
+            break;
+        case WH_CREATURE_POSITION:
+            hs.vec(c.pos); hs.vec(c.vel); hs.f32(c.yaw);
+            break;
+        case WH_CREATURE_GENOME:
+            hs.floats(c.genome.raw.data(), GENOME_SIZE);
+            break;
+        case WH_CREATURE_NEEDS:
+            hs.floats(c.needs.urgency.data(),    DRIVE_COUNT);
+            hs.floats(c.needs.craveRate.data(),  DRIVE_COUNT);
+            hs.floats(c.needs.desireMult.data(), DRIVE_COUNT);
+            break;
+        case WH_CREATURE_ENERGY:
+            hs.f32(c.energy); hs.f32(c.maxEnergy); hs.f32(c.age); hs.f32(c.lifespan); hs.f32(c.mass);
+            break;
+        case WH_CREATURE_BEHAVIOR:
+            hs.word((uint64_t)c.behavior); hs.f32(c.gestTimer); hs.word(c.mateTarget);
+            break;
+        case WH_CREATURE_PERCEPTION:
+            hs.word(c.nearestPredator);    hs.f32(c.nearestPredDist);
+            hs.word(c.nearestPrey);        hs.f32(c.nearestPreyDist);
+            hs.word(c.nearestMate);        hs.f32(c.nearestMateDist);
+            hs.word(c.nearestConspecific); hs.f32(c.nearestConspecificDist);
+            hs.vec(c.nearestFood);  hs.f32(c.nearestFoodDist); hs.word((uint32_t)c.nearestFoodIdx);
+            hs.vec(c.nearestWater); hs.f32(c.nearestWaterDist); hs.f32(c.waterCacheTimer);
+            hs.f32(c.cachedSlope);  hs.f32(c.slopeTimer);
+            break;
+    }
+}
+
+void hashPlant(Hasher& hs, const Plant& p) {
+    hs.vec(p.pos); hs.f32(p.nutrition); hs.f32(p.growTimer); hs.word(p.alive); hs.word(p.type);
+}
+
+void hashSpecies(Hasher& hs, const SpeciesInfo& s) {
+    hs.word(s.id); hs.str(s.name); hs.floats(s.centroid.raw.data(), GENOME_SIZE);
+    hs.word((uint32_t)s.count); hs.word((uint32_t)s.allTime); hs.floats(s.color, 3);
+}
+
+void hashWorldScalars(Hasher& hs, const World& w) {
+    hs.f32(w.simTime); hs.word(w.tickCount); hs.word(w.nextID); hs.word(w.nextSpeciesID);
+    hs.word(w.creatures.size()); hs.word(w.plants.size()); hs.word(w.species.size());
+}
+
+template <typename T, typename Hash>
+bool sameItem(const T& a, const T& b, Hash hash) {
+    Hasher ha, hb;
+    hash(ha, a);
+    hash(hb, b);
+    return ha.h == hb.h;
+}
+
+} // namespace
+
+const char* worldHashFieldName(int field) {
+    static const char* names[WH_FIELDS] = {
+        "world", "identity", "position", "genome", "needs",
+        "energy", "behavior", "perception", "plants", "species",
+    };
+    return field >= 0 && field < WH_FIELDS ? names[field] : "?";
+}
+
+uint64_t WorldHash::combined() const {
+    Hasher hs;
+    for (uint64_t f : field) hs.word(f);
+    return hs.finish();
+}
+
+bool WorldHash::operator==(const WorldHash& o) const {
+    return std::memcmp(field, o.field, sizeof(field)) == 0;
+}
+
+WorldHash hashWorld(const World& w) {
+    WorldHash out;
+    Hasher hs[WH_FIELDS];
+    hashWorldScalars(hs[WH_WORLD], w);
+    for (const Creature& c : w.creatures)
+        for (int f = WH_CREATURE_IDENTITY; f <= WH_CREATURE_PERCEPTION; f++) hashCreature(hs[f], c, f);
+    for (const Plant& p : w.plants)         hashPlant(hs[WH_PLANTS], p);
+    for (const SpeciesInfo& s : w.species)  hashSpecies(hs[WH_SPECIES], s);
+    for (int f = 0; f < WH_FIELDS; f++) out.field[f] = hs[f].finish();
+    return out;
+}
+
+std::string describeWorldDifference(const World& a, const World& b) {
+    char buf[224];
+    if (!sameItem(a, b, hashWorldScalars)) {
+        std::snprintf(buf, sizeof(buf), "world: t %.9g/%.9g, tick %llu/%llu, creatures %zu/%zu, plants %zu/%zu, species %zu/%zu, nextID %u/%u",
+                      a.simTime, b.simTime, (unsigned long long)a.tickCount, (unsigned long long)b.tickCount,
+                      a.creatures.size(), b.creatures.size(), a.plants.size(), b.plants.size(),
+                      a.species.size(), b.species.size(), (unsigned)a.nextID, (unsigned)b.nextID);
+        if (a.creatures.size() != b.creatures.size() || a.plants.size() != b.plants.size()
+            || a.species.size() != b.species.size())
+            return buf;   // per-entity comparison below needs equal counts
+    }
+    for (size_t i = 0; i < a.creatures.size(); i++) {
+        for (int f = WH_CREATURE_IDENTITY; f <= WH_CREATURE_PERCEPTION; f++) {
+            auto hash = [f](Hasher& hs, const Creature& c) { hashCreature(hs, c, f); };
+            if (sameItem(a.creatures[i], b.creatures[i], hash)) continue;
+            std::snprintf(buf, sizeof(buf), "creature #%u (index %zu): %s",
+                          (unsigned)a.creatures[i].id, i, worldHashFieldName(f));
+            return buf;
+        }
+    }
+    for (size_t i = 0; i < a.plants.size(); i++) {
+        if (sameItem(a.plants[i], b.plants[i], hashPlant)) continue;
+        std::snprintf(buf, sizeof(buf), "plant %zu", i);
+        return buf;
+    }
+    for (size_t i = 0; i < a.species.size(); i++) {
+        if (sameItem(a.species[i], b.species[i], hashSpecies)) continue;
+        std::snprintf(buf, sizeof(buf), "species %u (index %zu)", a.species[i].id, i);
+        return buf;
+    }
+    return sameItem(a, b, hashWorldScalars) ? std::string() : std::string(buf);
+}
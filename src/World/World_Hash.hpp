@@ -0,0 +1,45 @@
+#pragma once
+// ── World_Hash.hpp ────────────────────────────────────────────────────────────
+// Canonical world-state hashing, for proving a change leaves the simulation
+// bit-for-bit unchanged.
+//
+// The state is hashed as separate fields (creature identity, position,
+// genome, ...), each over every entity in storage order, so two runs that
+// diverge can be told apart by tick and by what diverged. Floats are hashed
+// by bit pattern: any change at all counts. Cost is one pass over the
+// entities, cheap enough to run every tick.
+
+#include "World.hpp"
+#include <cstdint>
+#include <string>
+
+enum WorldHashField : int {
+    WH_WORLD,                // sim time, tick count, ID counters, entity counts
+    WH_CREATURE_IDENTITY,    // id, parents, generation, species, alive
+    WH_CREATURE_POSITION,    // pos, vel, yaw
+    WH_CREATURE_GENOME,
+    WH_CREATURE_NEEDS,       // urgency, crave rates, desire multipliers
+    WH_CREATURE_ENERGY,      // energy, max energy, age, lifespan, mass
+    WH_CREATURE_BEHAVIOR,    // behaviour, gestation, mate
+    WH_CREATURE_PERCEPTION,  // perception cache and slope/water timers
+    WH_PLANTS,
+    WH_SPECIES,              // id, name, centroid, counts
+    WH_FIELDS
+};
+
+const char* worldHashFieldName(int field);
+
+struct WorldHash {
+    uint64_t field[WH_FIELDS] = {};
+
+    uint64_t combined() const;
+    bool operator==(const WorldHash& o) const;
+    bool operator!=(const WorldHash& o) const { return !(*this == o); }
+};
+
+WorldHash hashWorld(const World& w);
+
+// Locate the first difference between two worlds that hashed differently:
+// "creature #812 (index 40): position", "plant 17", "species count" and so
+// on. Empty if the hashed state is identical.
+std::string describeWorldDifference(const World& a, const World& b);
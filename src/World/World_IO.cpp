@@ -1,7 +1,7 @@
 // ── Save / Load ───────────────────────────────────────────────────────────────
 // Binary format layout:
 //   [4]  magic "EVOS"
-//   [4]  version uint32 = 2
+//   [4]  version uint32 = 3
 //   [4]  simTime float
 //   [4]  nextID uint32
 //   [4]  nextSpeciesID uint32
@@ -10,8 +10,9 @@
 //                 generation, speciesID (uint32×2)
 //                 pos.xyz, vel.xyz, yaw (float×7)
 //                 genome.raw (float×GENOME_SIZE)
-//                 needs.level (float×DRIVE_COUNT)
+//                 needs.urgency (float×DRIVE_COUNT)
 //                 needs.craveRate (float×DRIVE_COUNT)
+//                 needs.desireMult (float×DRIVE_COUNT)
 //                 energy, maxEnergy, age, lifespan, mass (float×5)
 //                 behavior (uint32)
 //                 gestTimer (float)
@@ -26,232 +27,271 @@
 //                 color (float×3)
 //                 centroid.raw (float×GENOME_SIZE)
 //                 nameLen (uint32) + name bytes
+//
+// Saving goes through a WorldSnapshot so the same encoder serves the
+// synchronous path below and the background saver (World_AsyncSave.cpp).
+//
+// New saves are written in the sectioned EVOX container (World_Sections.hpp),
+// which reuses the record codecs below; EVOS files are still read, and can
+// still be written with writeSnapshotFile for older builds and tools. EVOS has
+// no tick counter: a world loaded from one counts its RNG ticks from 0.
 
 #include <cstring>
-#include <fstream>
 #include "World.hpp"
+#include "World_Snapshot.hpp"
+#include "World_Export.hpp"
+#include "World_Sections.hpp"
+#include "Core/file_management.hpp"
+
+static constexpr uint32_t SAVE_VERSION = 3;
+
+// ── Record codecs ─────────────────────────────────────────────────────────────
+void writeCreatureRecord(ByteWriter& w, const Creature& c) {
+    // Identity
+    w.writeU32(c.id);
+    w.writeU32(c.parentA);
+    w.writeU32(c.parentB);
+    w.writeU32(c.generation);
+    w.writeU32(c.speciesID);
+
+    // Spatial state
+    w.writeF(c.pos.x); w.writeF(c.pos.y); w.writeF(c.pos.z);
+    w.writeF(c.vel.x); w.writeF(c.vel.y); w.writeF(c.vel.z);
+    w.writeF(c.yaw);
+
+    // Genome
+    w.writeFA(c.genome.raw.data(), GENOME_SIZE);
+
+    // Needs
+    w.writeFA(c.needs.urgency.data(), DRIVE_COUNT);
+    w.writeFA(c.needs.craveRate.data(), DRIVE_COUNT);
+    w.writeFA(c.needs.desireMult.data(), DRIVE_COUNT);
+
+    // Biology
+    w.writeF(c.energy);
+    w.writeF(c.maxEnergy);
+    w.writeF(c.age);
+    w.writeF(c.lifespan);
+    w.writeF(c.mass);
+
+    // Behaviour
+    w.writeU32(static_cast<uint32_t>(c.behavior));
+    w.writeF(c.gestTimer);
+    w.writeU32(c.mateTarget);
+}
 
-bool World::saveToFile(const char* path) const {
-    std::ofstream f(path, std::ios::binary);
-    if (!f) return false;
-
-    // Helper lambdas for clean writes
-    auto writeF  = [&](float v)    { f.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
-    auto writeU32= [&](uint32_t v) { f.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
-    auto writeI32= [&](int32_t v)  { f.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
-    auto writeU8 = [&](uint8_t v)  { f.write(reinterpret_cast<const char*>(&v), sizeof(v)); };
-    auto writeFA = [&](const float* arr, int n) {
-        f.write(reinterpret_cast<const char*>(arr), sizeof(float) * n);
-    };
-    auto writeVec3 = [&](const Vec3& v) {
-        writeF(v.x); writeF(v.y); writeF(v.z);
-    };
+void readCreatureRecord(ByteReader& r, Creature& c) {
+    c = Creature{};   // perception cache back to defaults; repopulated next tick
+    c.alive = true;
 
-    // Header
-    f.write("EVOS", 4);
-    writeU32(3);   // version
+    c.id         = r.readU32();
+    c.parentA    = r.readU32();
+    c.parentB    = r.readU32();
+    c.generation = r.readU32();
+    c.speciesID  = r.readU32();
 
-    // World time and ID counters
-    writeF(simTime);
-    writeU32(nextID);
-    writeU32(nextSpeciesID);
+    c.pos.x = r.readF(); c.pos.y = r.readF(); c.pos.z = r.readF();
+    c.vel.x = r.readF(); c.vel.y = r.readF(); c.vel.z = r.readF();
+    c.yaw   = r.readF();
 
-    // ── Creatures ─────────────────────────────────────────────────────────────
+    r.readFA(c.genome.raw.data(), GENOME_SIZE);
+
+    r.readFA(c.needs.urgency.data(), DRIVE_COUNT);
+    r.readFA(c.needs.craveRate.data(), DRIVE_COUNT);
+    r.readFA(c.needs.desireMult.data(), DRIVE_COUNT);
+
+    c.energy    = r.readF();
+    c.maxEnergy = r.readF();
+    c.age       = r.readF();
+    c.lifespan  = r.readF();
+    c.mass      = r.readF();
+
+    c.behavior   = static_cast<BehaviorState>(r.readU32());
+    c.gestTimer  = r.readF();
+    c.mateTarget = r.readU32();
+}
+
+void writePlantRecord(ByteWriter& w, const Plant& p) {
+    w.writeF(p.pos.x); w.writeF(p.pos.y); w.writeF(p.pos.z);
+    w.writeF(p.nutrition);
+    w.writeF(p.growTimer);
+    w.writeU8(p.alive ? 1 : 0);
+    w.writeU8(p.type);
+}
+
+void readPlantRecord(ByteReader& r, Plant& p) {
+    p.pos.x     = r.readF(); p.pos.y = r.readF(); p.pos.z = r.readF();
+    p.nutrition = r.readF();
+    p.growTimer = r.readF();
+    p.alive     = r.readU8() != 0;
+    p.type      = r.readU8();
+}
+
+void writeSpeciesRecord(ByteWriter& w, const SpeciesInfo& sp) {
+    w.writeU32(sp.id);
+    w.writeI32(sp.count);
+    w.writeI32(sp.allTime);
+    w.writeFA(sp.color, 3);
+    w.writeFA(sp.centroid.raw.data(), GENOME_SIZE);
+    w.writeU32(static_cast<uint32_t>(sp.name.size()));
+    w.write(sp.name.data(), sp.name.size());
+}
+
+void readSpeciesRecord(ByteReader& r, SpeciesInfo& sp) {
+    sp.id      = r.readU32();
+    sp.count   = r.readI32();
+    sp.allTime = r.readI32();
+    r.readFA(sp.color, 3);
+    r.readFA(sp.centroid.raw.data(), GENOME_SIZE);
+    uint32_t nlen = r.readU32();
+    if (nlen > r.remaining()) { r.ok = false; return; }   // corrupt length
+    sp.name.resize(nlen);
+    if (nlen > 0) r.read(&sp.name[0], nlen);
+}
+
+// ── Snapshot encoding ─────────────────────────────────────────────────────────
+void encodeSnapshot(const WorldSnapshot& snap, ByteWriter& out,
+                    const std::function<void(float)>& onProgress) {
     // Only save alive creatures; dead ones will be removed anyway
     uint32_t cntAlive = 0;
-    for (const auto& c : creatures) if (c.alive) cntAlive++;
-    writeU32(cntAlive);
+    for (const auto& c : snap.creatures) if (c.alive) cntAlive++;
 
-    for (const auto& c : creatures) {
-        if (!c.alive) continue;
+    out.clear();
+    out.reserve(24 + cntAlive * CREATURE_RECORD_BYTES
+                   + snap.plants.size() * PLANT_RECORD_BYTES
+                   + snap.species.size() * 256);
 
-        // Identity
-        writeU32(c.id);
-        writeU32(c.parentA);
-        writeU32(c.parentB);
-        writeU32(c.generation);
-        writeU32(c.speciesID);
-
-        // Spatial state
-        writeVec3(c.pos);
-        writeVec3(c.vel);
-        writeF(c.yaw);
-
-        // Genome
-        writeFA(c.genome.raw.data(), GENOME_SIZE);
-
-        // Needs
-        writeFA(c.needs.urgency.data(), DRIVE_COUNT);
-        writeFA(c.needs.craveRate.data(), DRIVE_COUNT);
-        writeFA(c.needs.desireMult.data(), DRIVE_COUNT);
-
-        // Biology
-        writeF(c.energy);
-        writeF(c.maxEnergy);
-        writeF(c.age);
-        writeF(c.lifespan);
-        writeF(c.mass);
-
-        // Behaviour
-        writeU32(static_cast<uint32_t>(c.behavior));
-        writeF(c.gestTimer);
-        writeU32(c.mateTarget);
+    // Header
+    out.write("EVOS", 4);
+    out.writeU32(SAVE_VERSION);
+
+    // World time and ID counters
+    out.writeF(snap.simTime);
+    out.writeU32(snap.nextID);
+    out.writeU32(snap.nextSpeciesID);
+
+    // ── Creatures ─────────────────────────────────────────────────────────────
+    out.writeU32(cntAlive);
+    size_t done = 0;
+    for (const auto& c : snap.creatures) {
+        if (!c.alive) continue;
+        writeCreatureRecord(out, c);
+        // Creatures dominate the file size, so they drive the progress fraction
+        if (onProgress && (++done & 4095) == 0)
+            onProgress((float)done / (float)cntAlive);
     }
 
     // ── Plants ────────────────────────────────────────────────────────────────
-    uint32_t pcnt = static_cast<uint32_t>(plants.size());
-    writeU32(pcnt);
-    for (const auto& p : plants) {
-        writeVec3(p.pos);
-        writeF(p.nutrition);
-        writeF(p.growTimer);
-        writeU8(p.alive ? 1 : 0);
-        writeU8(p.type);
-    }
+    out.writeU32(static_cast<uint32_t>(snap.plants.size()));
+    for (const auto& p : snap.plants) writePlantRecord(out, p);
 
     // ── Species ───────────────────────────────────────────────────────────────
-    uint32_t scnt = static_cast<uint32_t>(species.size());
-    writeU32(scnt);
-    for (const auto& sp : species) {
-        writeU32(sp.id);
-        writeI32(sp.count);
-        writeI32(sp.allTime);
-        writeFA(sp.color, 3);
-        writeFA(sp.centroid.raw.data(), GENOME_SIZE);
-        uint32_t nlen = static_cast<uint32_t>(sp.name.size());
-        writeU32(nlen);
-        f.write(sp.name.c_str(), nlen);
-    }
+    out.writeU32(static_cast<uint32_t>(snap.species.size()));
+    for (const auto& sp : snap.species) writeSpeciesRecord(out, sp);
 
-    return f.good();
+    if (onProgress) onProgress(1.f);
 }
 
-bool World::loadFromFile(const char* path) {
-    std::ifstream f(path, std::ios::binary);
-    if (!f) return false;
-
-    // Helper lambdas for clean reads
-    auto readF  = [&]() -> float    { float v=0;    f.read(reinterpret_cast<char*>(&v), sizeof(v)); return v; };
-    auto readU32= [&]() -> uint32_t { uint32_t v=0; f.read(reinterpret_cast<char*>(&v), sizeof(v)); return v; };
-    auto readI32= [&]() -> int32_t  { int32_t v=0;  f.read(reinterpret_cast<char*>(&v), sizeof(v)); return v; };
-    auto readU8 = [&]() -> uint8_t  { uint8_t v=0;  f.read(reinterpret_cast<char*>(&v), sizeof(v)); return v; };
-    auto readFA = [&](float* arr, int n) {
-        f.read(reinterpret_cast<char*>(arr), sizeof(float) * n);
-    };
-    auto readVec3 = [&]() -> Vec3 {
-        Vec3 v; v.x=readF(); v.y=readF(); v.z=readF(); return v;
-    };
+bool decodeSnapshot(const uint8_t* data, size_t size, WorldSnapshot& out) {
+    ByteReader r(data, size);
 
     // ── Header ────────────────────────────────────────────────────────────────
     char magic[4] = {};
-    f.read(magic, 4);
+    r.read(magic, 4);
     if (std::strncmp(magic, "EVOS", 4) != 0) return false;
 
-    uint32_t version = readU32();
-    if (version != 3) return false;   // incompatible version
+    uint32_t version = r.readU32();
+    if (version != SAVE_VERSION) return false;   // incompatible version
 
     // ── World state ───────────────────────────────────────────────────────────
-    simTime       = readF();
-    nextID        = readU32();
-    nextSpeciesID = readU32();
+    out.simTime       = r.readF();
+    out.tickCount     = 0;
+    out.nextID        = r.readU32();
+    out.nextSpeciesID = r.readU32();
 
     // ── Creatures ─────────────────────────────────────────────────────────────
-    creatures.clear();
-    idToIndex.clear();
-
-    uint32_t cCount = readU32();
-    creatures.resize(cCount);
-
-    for (uint32_t i = 0; i < cCount; i++) {
-        Creature& c = creatures[i];
-        c.alive = true;
-
-        c.id         = readU32();
-        c.parentA    = readU32();
-        c.parentB    = readU32();
-        c.generation = readU32();
-        c.speciesID  = readU32();
-
-        c.pos = readVec3();
-        c.vel = readVec3();
-        c.yaw = readF();
+    // Counts are validated against the remaining bytes before resizing so a
+    // corrupt header can't trigger a multi-GB allocation.
+    uint32_t cCount = r.readU32();
+    if ((uint64_t)cCount * CREATURE_RECORD_BYTES > r.remaining()) return false;
+    out.creatures.resize(cCount);
+    for (auto& c : out.creatures) readCreatureRecord(r, c);
 
-        readFA(c.genome.raw.data(), GENOME_SIZE);
+    // ── Plants ────────────────────────────────────────────────────────────────
+    uint32_t pCount = r.readU32();
+    if ((uint64_t)pCount * PLANT_RECORD_BYTES > r.remaining()) return false;
+    out.plants.resize(pCount);
+    for (auto& p : out.plants) readPlantRecord(r, p);
 
-        readFA(c.needs.urgency.data(), DRIVE_COUNT);
-        readFA(c.needs.craveRate.data(), DRIVE_COUNT);
-        readFA(c.needs.desireMult.data(), DRIVE_COUNT);
+    // ── Species ───────────────────────────────────────────────────────────────
+    uint32_t sCount = r.readU32();
+    if ((uint64_t)sCount * SPECIES_RECORD_MIN_BYTES > r.remaining()) return false;
+    out.species.resize(sCount);
+    for (auto& sp : out.species) readSpeciesRecord(r, sp);
 
-        c.energy    = readF();
-        c.maxEnergy = readF();
-        c.age       = readF();
-        c.lifespan  = readF();
-        c.mass      = readF();
+    return r.ok;
+}
 
-        c.behavior   = static_cast<BehaviorState>(readU32());
-        c.gestTimer  = readF();
-        c.mateTarget = readU32();
+bool writeSnapshotFile(const WorldSnapshot& snap, const std::string& path,
+                       const std::function<void(float)>& onProgress) {
+    ByteWriter buf;
+    encodeSnapshot(snap, buf, [&](float f){ if (onProgress) onProgress(f * 0.5f); });
+    return writeFileDurable(path, buf.bytes.data(), buf.size(),
+                            [&](float f){ if (onProgress) onProgress(0.5f + f * 0.5f); });
+}
 
-        // Perception cache: reset to defaults (will be repopulated on next tick)
-        c.nearestPredator = INVALID_ID; c.nearestPredDist = 1e9f;
-        c.nearestPrey     = INVALID_ID; c.nearestPreyDist = 1e9f;
-        c.nearestMate     = INVALID_ID; c.nearestMateDist = 1e9f;
-        c.nearestFoodDist = 1e9f;
-        c.nearestFoodIdx  = -1;
-        c.nearestWaterDist= 1e9f;
+bool readSnapshotFile(const std::string& path, WorldSnapshot& out) {
+    std::vector<uint8_t> bytes;
+    if (!readFileBytes(path, bytes)) return false;
+    if (bytes.size() >= 4 && std::memcmp(bytes.data(), "EVOX", 4) == 0)
+        return decodeSectioned(bytes.data(), bytes.size(), out);
+    return decodeSnapshot(bytes.data(), bytes.size(), out);
+}
 
-        idToIndex[c.id] = i;
-    }
+// ── World ↔ snapshot ──────────────────────────────────────────────────────────
+void World::captureSnapshot(WorldSnapshot& out) const {
+    out.simTime       = simTime;
+    out.tickCount     = tickCount;
+    out.nextID        = nextID;
+    out.nextSpeciesID = nextSpeciesID;
+    out.creatures     = creatures;   // trivially copyable → one block copy
+    out.plants        = plants;
+    out.species       = species;
+}
 
-    // ── Plants ────────────────────────────────────────────────────────────────
-    plants.clear();
-    uint32_t pCount = readU32();
-    plants.resize(pCount);
-
-    for (uint32_t i = 0; i < pCount; i++) {
-        Plant& p   = plants[i];
-        p.pos      = readVec3();
-        p.nutrition= readF();
-        p.growTimer= readF();
-        p.alive    = readU8() != 0;
-        p.type     = readU8();
-    }
+void World::restoreSnapshot(const WorldSnapshot& snap) {
+    simTime       = snap.simTime;
+    tickCount     = snap.tickCount;
+    nextID        = snap.nextID;
+    nextSpeciesID = snap.nextSpeciesID;
+    creatures     = snap.creatures;
+    plants        = snap.plants;
+    species       = snap.species;
 
-    // ── Species ───────────────────────────────────────────────────────────────
-    species.clear();
-    uint32_t sCount = readU32();
-    species.resize(sCount);
-
-    for (uint32_t i = 0; i < sCount; i++) {
-        SpeciesInfo& sp = species[i];
-        sp.id      = readU32();
-        sp.count   = readI32();
-        sp.allTime = readI32();
-        readFA(sp.color, 3);
-        readFA(sp.centroid.raw.data(), GENOME_SIZE);
-        uint32_t nlen = readU32();
-        sp.name.resize(nlen);
-        if (nlen > 0) f.read(&sp.name[0], nlen);
-    }
+    idToIndex.clear();
+    for (size_t i = 0; i < creatures.size(); i++)
+        idToIndex[creatures[i].id] = i;
 
     // Mark all terrain chunks dirty so the renderer rebuilds them on next frame
     // (terrain itself did not change, but chunk mesh cache may be stale)
     for (auto& ch : chunks) ch.dirty = true;
+}
+
+bool World::saveToFile(const char* path) const {
+    WorldSnapshot snap;
+    captureSnapshot(snap);
+    return writeSectionedFile(snap, path);
+}
 
-    return f.good();
+bool World::loadFromFile(const char* path) {
+    WorldSnapshot snap;
+    if (!readSnapshotFile(path, snap)) return false;
+    restoreSnapshot(snap);
+    return true;
 }
 
 // ── CSV export ────────────────────────────────────────────────────────────────
+// The original column set; see World_Export.hpp for the configurable exporter.
 void World::exportCSV(const char* path) const {
-    std::ofstream f(path);
-    if (!f) return;
-    f << "id,species,x,y,z,age,energy,speed,herbEff,carnEff\n";
-    for (const auto& c : creatures) {
-        f << c.id << ',' << c.speciesID << ','
-          << c.pos.x << ',' << c.pos.y << ',' << c.pos.z << ','
-          << c.age << ',' << c.energy << ','
-          << c.genome.maxSpeed() << ','
-          << c.genome.herbEfficiency() << ','
-          << c.genome.carnEfficiency() << '\n';
-    }
+    exportCreaturesCSV(creatures, species, path);
 }
@@ -14,7 +14,10 @@
 //  5. Scan all plants for the nearest visible food source
 //  6. Search nearby tiles for the nearest water source
 //  7. Update the Fear drive based on predator proximity
-void World::perceive(Creature& c, float dt) {
+//
+// Returns the number of candidates the spatial query produced, the measure of
+// local density the cost attribution bins by.
+uint32_t World::perceive(Creature& c, float dt) {
     ZoneScoped;
     float range  = c.genome.visionRange();
     // Half-angle of the FOV cone in radians; creatures behind are invisible
@@ -35,10 +38,12 @@ void World::perceive(Creature& c, float dt) {
     // Project onto the tangent plane at this creature's position and renormalise.
     facing = g_planet_surface.projectToTangent(c.pos, facing).normalised();
 
+    uint32_t candidates;
     {
         ZoneScopedN("perceive_creatures");
         static thread_local std::vector<uint32_t> nearby; // Reused capacity
         queryRadius(c.pos, range, nearby);
+        candidates = (uint32_t)nearby.size();
 
         float nearestPredDist2 = 1e18f;
         float nearestPreyDist2 = 1e18f;
@@ -137,7 +142,7 @@ void World::perceive(Creature& c, float dt) {
         c.waterCacheTimer -= dt;
 
         if (c.waterCacheTimer <= 0.f) {
-            c.waterCacheTimer = 2.0f + globalRNG().range(0.0f, 1.0f); // Stagger
+            c.waterCacheTimer = 2.0f + rngFor(c.id, RNG_WATER).range(0.0f, 1.0f); // Stagger
             Vec3 waterPos;
             if (g_planet_surface.findOcean(c.pos, range, waterPos)) {
                 c.nearestWater = waterPos;
@@ -160,4 +165,5 @@ void World::perceive(Creature& c, float dt) {
         // No predator in sight: fear gradually decays back toward 0
         c.needs.decayFear(1.f/60.f);
     }
+    return candidates;
 }
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "World_Rewind.hpp"
+#include "World_Checkpoint.hpp"
+#include "Core/Trace.hpp"
+#include <algorithm>
+#include <chrono>
+
+RewindBuffer::RewindBuffer() {
+    worker = std::thread([this]{ workerLoop(); });
+}
+
+RewindBuffer::~RewindBuffer() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        quit = true;
+    }
+    cv.notify_one();
+    if (worker.joinable()) worker.join();
+}
+
+void RewindBuffer::tick(const World& world) {
+    if (!enabled) return;
+
+    // Sim time went backwards (load, reset, checkpoint restore): the ring
+    // describes a timeline the world is no longer on.
+    if (world.simTime < lastCaptureTime) clear();
+
+    if (lastCaptureTime >= 0.f && world.simTime - lastCaptureTime < interval) return;
+    if (busy.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(mtx);
+        st.deferred++;   // try again next frame
+        return;
+    }
+
+    using Clock = std::chrono::high_resolution_clock;
+    auto t0 = Clock::now();
+    world.captureSnapshot(pending);
+    float ms = std::chrono::duration<float, std::milli>(Clock::now() - t0).count();
+    lastCaptureTime = world.simTime;
+
+    busy.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        pendingGeneration = generation;
+        pendingCapMB      = memoryCapMB;   // the UI writes memoryCapMB unlocked
+        hasJob            = true;
+        st.lastCaptureMs  = ms;
+        st.maxCaptureMs   = std::max(st.maxCaptureMs, ms);
+        captureMsSum     += ms;
+    }
+    cv.notify_one();
+}
+
+void RewindBuffer::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    frames.clear();
+    generation++;
+    st = RewindStats{};
+    captureMsSum = compressMsSum = 0.0;
+    lastCaptureTime = -1.f;
+}
+
+void RewindBuffer::listFrames(std::vector<RewindFrameInfo>& out) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    out.clear();
+    out.reserve(frames.size());
+    for (const auto& f : frames) out.push_back(f.info);
+}
+
+RewindStats RewindBuffer::stats() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return st;
+}
+
+bool RewindBuffer::restore(int index, World& world) {
+    std::vector<uint8_t> data;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (index < 0 || index >= (int)frames.size()) return false;
+        data = frames[index].data;
+    }
+
+    // Decompression happens outside the lock; the worker keeps running
+    WorldSnapshot snap;
+    if (!decompressSnapshot(data.data(), data.size(), snap)) return false;
+    world.restoreSnapshot(snap);
+    lastCaptureTime = world.simTime;
+
+    // The restored frame stays (it is the new branch point); newer ones go
+    std::lock_guard<std::mutex> lock(mtx);
+    while (!frames.empty() && frames.back().info.simTime > snap.simTime) {
+        st.memoryBytes -= frames.back().info.bytes;
+        st.rawBytes    -= frames.back().info.rawBytes;
+        frames.pop_back();
+    }
+    st.frames = (int)frames.size();
+    generation++;   // a frame being compressed right now belongs to the old branch
+    return true;
+}
+
+// Drop the oldest frames until the compressed total fits the budget. The
+// newest frame is always kept, even if it alone exceeds the cap.
+void RewindBuffer::evictToCap(int capMB) {
+    size_t cap = (size_t)std::max(capMB, 1) * 1024 * 1024;
+    while (frames.size() > 1 && st.memoryBytes > cap) {
+        st.memoryBytes -= frames.front().info.bytes;
+        st.rawBytes    -= frames.front().info.rawBytes;
+        frames.pop_front();
+        st.evicted++;
+    }
+    st.frames = (int)frames.size();
+}
+
+void RewindBuffer::workerLoop() {
+    trace().nameThread("rewind");
+    for (;;) {
+        uint64_t gen;
+        int      capMB;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this]{ return quit || hasJob; });
+            if (quit) return;   // in-memory only, nothing worth finishing
+            hasJob = false;
+            gen    = pendingGeneration;
+            capMB  = pendingCapMB;
+        }
+
+        TRACE_SCOPE("Rewind compress");
+        using Clock = std::chrono::high_resolution_clock;
+        auto t0 = Clock::now();
+        Frame f;
+        f.info.simTime    = pending.simTime;
+        f.info.population = (uint32_t)std::count_if(pending.creatures.begin(), pending.creatures.end(),
+                                                    [](const Creature& c){ return c.alive; });
+        f.info.speciesAlive = (uint32_t)std::count_if(pending.species.begin(), pending.species.end(),
+                                                      [](const SpeciesInfo& s){ return s.count > 0; });
+        f.info.rawBytes   = compressSnapshot(pending, f.data);
+        f.data.shrink_to_fit();
+        f.info.bytes      = f.data.size();
+        float ms = std::chrono::duration<float, std::milli>(Clock::now() - t0).count();
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (gen == generation) {
+                st.memoryBytes += f.info.bytes;
+                st.rawBytes    += f.info.rawBytes;
+                frames.push_back(std::move(f));
+                st.captured++;
+                st.lastCompressMs = ms;
+                compressMsSum    += ms;
+                st.avgCompressMs  = (float)(compressMsSum / st.captured);
+                st.avgCaptureMs   = (float)(captureMsSum / st.captured);
+                evictToCap(capMB);
+            }
+        }
+        busy.store(false, std::memory_order_release);
+    }
+}
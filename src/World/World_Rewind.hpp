@@ -0,0 +1,102 @@
+#pragma once
+// ── World_Rewind.hpp ──────────────────────────────────────────────────────────
+// Bounded in-memory ring of compressed world states for scrubbing back in time.
+//
+// Every `interval` sim seconds tick() takes a WorldSnapshot on the main thread
+// (a bulk copy at the tick boundary) and hands it to a worker thread, which
+// compresses it (same codec as a checkpoint base record) and appends it to the
+// ring. When the compressed frames exceed `memoryCapMB` the oldest are evicted.
+//
+// If the worker is still compressing the previous frame when the next capture
+// is due, the capture is deferred to a later frame rather than queued, so the
+// main thread never waits and never holds more than one raw snapshot extra.
+//
+// Restoring a frame replaces the live world and discards all newer frames: the
+// simulation continues on a new branch from that point.
+
+#include "World_Snapshot.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct RewindFrameInfo {
+    float    simTime     = 0.f;
+    uint32_t population  = 0;
+    uint32_t speciesAlive= 0;
+    size_t   bytes       = 0;   // compressed size in memory
+    size_t   rawBytes    = 0;   // size before compression
+};
+
+struct RewindStats {
+    int      frames          = 0;
+    size_t   memoryBytes     = 0;   // sum of compressed frames
+    size_t   rawBytes        = 0;   // what the same frames would cost uncompressed
+    uint32_t captured        = 0;   // frames compressed since the last clear
+    uint32_t deferred        = 0;   // captures postponed because the worker was busy
+    uint32_t evicted         = 0;   // frames dropped to honour the memory cap
+    float    lastCaptureMs   = 0.f; // main-thread snapshot copy
+    float    avgCaptureMs    = 0.f;
+    float    maxCaptureMs    = 0.f;
+    float    lastCompressMs  = 0.f; // worker-thread compression
+    float    avgCompressMs   = 0.f;
+};
+
+struct RewindBuffer {
+    // ── Config (exposed in the Settings window) ───────────────────────────────
+    bool  enabled     = false;
+    float interval    = 30.f;   // sim seconds between captures
+    int   memoryCapMB = 256;    // compressed frames kept within this budget
+
+    RewindBuffer();
+    ~RewindBuffer();
+    RewindBuffer(const RewindBuffer&)            = delete;
+    RewindBuffer& operator=(const RewindBuffer&) = delete;
+
+    // Call once per frame after World::tick; captures when a frame is due.
+    void tick(const World& world);
+
+    // Drop every frame (e.g. after loading a different world).
+    void clear();
+
+    // Copy the frame descriptions, oldest first.
+    void listFrames(std::vector<RewindFrameInfo>& out) const;
+    RewindStats stats() const;
+
+    // Decompress frame `index` (oldest = 0) into `world`. Newer frames are
+    // discarded. Returns false if the index is stale or the frame is corrupt.
+    bool restore(int index, World& world);
+
+private:
+    struct Frame {
+        RewindFrameInfo      info;
+        std::vector<uint8_t> data;
+    };
+
+    void workerLoop();
+    void evictToCap(int capMB);   // requires mtx
+
+    std::thread             worker;
+    mutable std::mutex      mtx;
+    std::condition_variable cv;
+    bool                    quit   = false;   // guarded by mtx
+    bool                    hasJob = false;   // guarded by mtx
+
+    // Job slot: written by the main thread only while !busy, read by the worker
+    WorldSnapshot     pending;
+    uint64_t          pendingGeneration = 0;
+    int               pendingCapMB      = 256;   // guarded by mtx; memoryCapMB at hand-over,
+                                                 // the only copy the worker reads
+    std::atomic<bool> busy{false};
+
+    std::deque<Frame> frames;   // guarded by mtx
+    RewindStats       st;       // guarded by mtx
+    double            captureMsSum  = 0.0;   // guarded by mtx
+    double            compressMsSum = 0.0;   // guarded by mtx
+    uint64_t          generation    = 0;     // guarded by mtx; bumped by clear/restore so
+                                             // a frame compressed for the old timeline is dropped
+
+    float lastCaptureTime = -1.f;   // sim time of the last capture (main thread only)
+};
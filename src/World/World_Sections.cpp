@@ -0,0 +1,590 @@
+#include "World_Sections.hpp"
+#include "Core/Hash.hpp"
+#include "Core/Trace.hpp"
+#include "Core/file_management.hpp"
+#include <algorithm>
+#include <cstring>
+
+static constexpr uint32_t CONTAINER_VERSION = 1;
+static constexpr size_t   HEADER_BYTES      = 24;
+static constexpr size_t   ENTRY_BYTES       = 32;
+static constexpr size_t   MAX_SECTIONS      = 4096;   // sanity cap for corrupt headers
+
+// Highest payload version this build understands, per section type
+static uint32_t supportedVersion(uint32_t type) {
+    switch (type) {
+        case SECTION_META:      return 2;
+        case SECTION_SUMMARY:   return 1;
+        case SECTION_SPECIES:   return 1;
+        case SECTION_CREATURES: return 1;
+        case SECTION_PLANTS:    return 1;
+        default:                return 0;   // unknown type
+    }
+}
+
+std::string sectionTagName(uint32_t type) {
+    std::string s(4, ' ');
+    for (int i = 0; i < 4; i++) {
+        char ch = (char)((type >> (i * 8)) & 0xFF);
+        s[i] = (ch >= 32 && ch < 127) ? ch : '?';
+    }
+    return s;
+}
+
+void SummaryBuilder::add(const Creature& c) {
+    if (!c.alive) return;
+    s.population++;
+    if (c.isHerbivore()) s.herbivores++;
+    else if (c.isCarnivore()) s.carnivores++;
+    s.maxGeneration = std::max(s.maxGeneration, c.generation);
+    sumGen    += c.generation;
+    sumSpeed  += c.genome.maxSpeed();
+    sumSize   += c.genome.bodySize();
+    sumEnergy += c.energy;
+}
+
+void SummaryBuilder::merge(const SummaryBuilder& o) {
+    s.population    += o.s.population;
+    s.herbivores    += o.s.herbivores;
+    s.carnivores    += o.s.carnivores;
+    s.speciesAlive  += o.s.speciesAlive;
+    s.speciesTotal  += o.s.speciesTotal;
+    s.plantsAlive   += o.s.plantsAlive;
+    s.maxGeneration  = std::max(s.maxGeneration, o.s.maxGeneration);
+    sumGen    += o.sumGen;
+    sumSpeed  += o.sumSpeed;
+    sumSize   += o.sumSize;
+    sumEnergy += o.sumEnergy;
+}
+
+SaveSummary SummaryBuilder::finish(float simTime) {
+    s.simTime = simTime;
+    if (s.population > 0) {
+        s.avgGeneration = (float)(sumGen    / s.population);
+        s.avgSpeed      = (float)(sumSpeed  / s.population);
+        s.avgSize       = (float)(sumSize   / s.population);
+        s.avgEnergy     = (float)(sumEnergy / s.population);
+    }
+    return s;
+}
+
+SaveSummary summarizeSnapshot(const WorldSnapshot& snap) {
+    SummaryBuilder b;
+    for (const auto& c : snap.creatures) b.add(c);
+    for (const auto& p : snap.plants)    b.add(p);
+    for (const auto& sp : snap.species)  b.add(sp);
+    return b.finish(snap.simTime);
+}
+
+// ── Payload codecs ────────────────────────────────────────────────────────────
+void writeMetaRecord(ByteWriter& w, const SaveMeta& m) {
+    w.writeF(m.simTime);
+    w.writeU32(m.nextID);
+    w.writeU32(m.nextSpeciesID);
+    w.writeU32(m.creatures);
+    w.writeU32(m.plants);
+    w.writeU32(m.species);
+    w.writeU64(m.tickCount);
+}
+
+void writeSummaryRecord(ByteWriter& w, const SaveSummary& s) {
+    w.writeF(s.simTime);
+    w.writeU32(s.population);
+    w.writeU32(s.herbivores);
+    w.writeU32(s.carnivores);
+    w.writeU32(s.speciesAlive);
+    w.writeU32(s.speciesTotal);
+    w.writeU32(s.plantsAlive);
+    w.writeU32(s.maxGeneration);
+    w.writeF(s.avgGeneration);
+    w.writeF(s.avgSpeed);
+    w.writeF(s.avgSize);
+    w.writeF(s.avgEnergy);
+}
+
+static bool decodeSummary(const uint8_t* p, size_t n, SaveSummary& s) {
+    ByteReader r(p, n);
+    s.simTime       = r.readF();
+    s.population    = r.readU32();
+    s.herbivores    = r.readU32();
+    s.carnivores    = r.readU32();
+    s.speciesAlive  = r.readU32();
+    s.speciesTotal  = r.readU32();
+    s.plantsAlive   = r.readU32();
+    s.maxGeneration = r.readU32();
+    s.avgGeneration = r.readF();
+    s.avgSpeed      = r.readF();
+    s.avgSize       = r.readF();
+    s.avgEnergy     = r.readF();
+    return r.ok;
+}
+
+static bool decodeMeta(const uint8_t* p, size_t n, uint32_t version, SaveMeta& m) {
+    ByteReader r(p, n);
+    m.simTime       = r.readF();
+    m.nextID        = r.readU32();
+    m.nextSpeciesID = r.readU32();
+    m.creatures     = r.readU32();
+    m.plants        = r.readU32();
+    m.species       = r.readU32();
+    m.tickCount     = version >= 2 ? r.readU64() : 0;   // v1 saves count ticks from load
+    return r.ok;
+}
+
+// Counts are validated against the payload size before resizing so a corrupt
+// section can't trigger a multi-GB allocation.
+static bool decodeCreatures(const uint8_t* p, size_t n, std::vector<Creature>& out) {
+    ByteReader r(p, n);
+    uint32_t count = r.readU32();
+    if ((uint64_t)count * CREATURE_RECORD_BYTES > r.remaining()) return false;
+    out.resize(count);
+    for (auto& c : out) readCreatureRecord(r, c);
+    return r.ok;
+}
+
+static bool decodePlants(const uint8_t* p, size_t n, std::vector<Plant>& out) {
+    ByteReader r(p, n);
+    uint32_t count = r.readU32();
+    if ((uint64_t)count * PLANT_RECORD_BYTES > r.remaining()) return false;
+    out.resize(count);
+    for (auto& pl : out) readPlantRecord(r, pl);
+    return r.ok;
+}
+
+static bool decodeSpecies(const uint8_t* p, size_t n, std::vector<SpeciesInfo>& out) {
+    ByteReader r(p, n);
+    uint32_t count = r.readU32();
+    if ((uint64_t)count * SPECIES_RECORD_MIN_BYTES > r.remaining()) return false;
+    out.resize(count);
+    for (auto& sp : out) readSpeciesRecord(r, sp);
+    return r.ok;
+}
+
+// ── Table ─────────────────────────────────────────────────────────────────────
+struct ContainerHeader {
+    uint32_t count      = 0;
+    uint32_t entryBytes = 0;
+    uint32_t tableCrc   = 0;
+};
+
+static bool parseHeader(const uint8_t* p, size_t n, ContainerHeader& h) {
+    if (n < HEADER_BYTES || std::memcmp(p, "EVOX", 4) != 0) return false;
+    ByteReader r(p + 4, n - 4);
+    uint32_t version = r.readU32();
+    h.count      = r.readU32();
+    h.entryBytes = r.readU32();
+    h.tableCrc   = r.readU32();
+    // Entries may grow in later versions, but the v1 fields must be there
+    return version <= CONTAINER_VERSION && h.count <= MAX_SECTIONS && h.entryBytes >= ENTRY_BYTES;
+}
+
+static bool parseTable(const uint8_t* p, size_t n, const ContainerHeader& h,
+                       uint64_t fileSize, std::vector<SaveSection>& out) {
+    if (n < (size_t)h.count * h.entryBytes || crc32(p, n) != h.tableCrc) return false;
+    out.resize(h.count);
+    for (uint32_t i = 0; i < h.count; i++) {
+        ByteReader r(p + (size_t)i * h.entryBytes, ENTRY_BYTES);
+        SaveSection& s = out[i];
+        s.type    = r.readU32();
+        s.version = r.readU32();
+        s.offset  = r.readU64();
+        s.length  = r.readU64();
+        s.crc     = r.readU32();
+        s.flags   = r.readU32();
+        if (s.offset > fileSize || s.length > fileSize - s.offset) return false;
+    }
+    return true;
+}
+
+static const SaveSection* findIn(const std::vector<SaveSection>& table, uint32_t type) {
+    for (const auto& s : table) if (s.type == type) return &s;
+    return nullptr;
+}
+
+bool sectionUsable(const SaveSection* s) {
+    return s && s->version >= 1 && s->version <= supportedVersion(s->type);
+}
+
+// The world can be rebuilt if every section we need is readable and no
+// section we don't understand claims to be essential.
+static bool tableLoadable(const std::vector<SaveSection>& table) {
+    for (uint32_t type : { SECTION_META, SECTION_SPECIES, SECTION_CREATURES, SECTION_PLANTS })
+        if (!sectionUsable(findIn(table, type))) return false;
+    for (const auto& s : table)
+        if ((s.flags & SECTION_REQUIRED) && !sectionUsable(&s)) return false;
+    return true;
+}
+
+bool parseSectionTable(const uint8_t* data, size_t size, std::vector<SaveSection>& out) {
+    ContainerHeader h;
+    if (!parseHeader(data, size, h)) return false;
+    if ((uint64_t)h.count * h.entryBytes > size - HEADER_BYTES) return false;
+    return parseTable(data + HEADER_BYTES, (size_t)h.count * h.entryBytes, h, size, out);
+}
+
+// ── Encoding ──────────────────────────────────────────────────────────────────
+// Header plus table; the table may end before the space reserved for it, since
+// payload offsets are absolute.
+static void writeHeaderAndTable(ByteWriter& out, const std::vector<SaveSection>& table) {
+    ByteWriter entries;
+    for (const auto& s : table) {
+        entries.writeU32(s.type);
+        entries.writeU32(s.version);
+        entries.writeU64(s.offset);
+        entries.writeU64(s.length);
+        entries.writeU32(s.crc);
+        entries.writeU32(s.flags);
+    }
+    out.clear();
+    out.write("EVOX", 4);
+    out.writeU32(CONTAINER_VERSION);
+    out.writeU32((uint32_t)table.size());
+    out.writeU32((uint32_t)ENTRY_BYTES);
+    out.writeU32(crc32(entries.bytes.data(), entries.size()));
+    out.writeU32(0);   // reserved
+    out.write(entries.bytes.data(), entries.size());
+}
+
+void encodeSectioned(const WorldSnapshot& snap, ByteWriter& out,
+                     const std::function<void(float)>& onProgress) {
+    uint32_t cntAlive = 0;
+    for (const auto& c : snap.creatures) if (c.alive) cntAlive++;
+
+    constexpr int N_SECTIONS = 5;
+    out.clear();
+    out.reserve(HEADER_BYTES + N_SECTIONS * ENTRY_BYTES + 64 * N_SECTIONS
+              + cntAlive * CREATURE_RECORD_BYTES
+              + snap.plants.size() * PLANT_RECORD_BYTES
+              + snap.species.size() * 256);
+
+    // Header and table are filled in once the payload offsets are known
+    out.bytes.resize(HEADER_BYTES + N_SECTIONS * ENTRY_BYTES);
+
+    std::vector<SaveSection> table;
+    auto begin = [&](uint32_t type, uint32_t flags) {
+        while (out.size() % 8) out.writeU8(0);
+        SaveSection s;
+        s.type    = type;
+        s.version = supportedVersion(type);
+        s.flags   = flags;
+        s.offset  = out.size();
+        table.push_back(s);
+    };
+    auto end = [&]() {
+        SaveSection& s = table.back();
+        s.length = out.size() - s.offset;
+        s.crc    = crc32(out.bytes.data() + s.offset, (size_t)s.length);
+    };
+
+    // Small sections first, so browsing a save reads only its first few KB
+    SaveMeta meta;
+    meta.simTime       = snap.simTime;
+    meta.tickCount     = snap.tickCount;
+    meta.nextID        = snap.nextID;
+    meta.nextSpeciesID = snap.nextSpeciesID;
+    meta.creatures     = cntAlive;
+    meta.plants        = (uint32_t)snap.plants.size();
+    meta.species       = (uint32_t)snap.species.size();
+    begin(SECTION_META, SECTION_REQUIRED);
+    writeMetaRecord(out, meta);
+    end();
+
+    begin(SECTION_SUMMARY, 0);
+    writeSummaryRecord(out, summarizeSnapshot(snap));
+    end();
+
+    begin(SECTION_SPECIES, SECTION_REQUIRED);
+    out.writeU32((uint32_t)snap.species.size());
+    for (const auto& sp : snap.species) writeSpeciesRecord(out, sp);
+    end();
+
+    begin(SECTION_CREATURES, SECTION_REQUIRED);
+    out.writeU32(cntAlive);
+    size_t done = 0;
+    for (const auto& c : snap.creatures) {
+        if (!c.alive) continue;
+        writeCreatureRecord(out, c);
+        if (onProgress && (++done & 4095) == 0)
+            onProgress((float)done / (float)cntAlive);
+    }
+    end();
+
+    begin(SECTION_PLANTS, SECTION_REQUIRED);
+    out.writeU32((uint32_t)snap.plants.size());
+    for (const auto& p : snap.plants) writePlantRecord(out, p);
+    end();
+
+    ByteWriter head;
+    writeHeaderAndTable(head, table);
+    std::memcpy(out.bytes.data(), head.bytes.data(), head.size());
+
+    if (onProgress) onProgress(1.f);
+}
+
+bool writeSectionedFile(const WorldSnapshot& snap, const std::string& path,
+                        const std::function<void(float)>& onProgress) {
+    TRACE_SCOPE("Sectioned save");
+    ByteWriter buf;
+    encodeSectioned(snap, buf, [&](float f){ if (onProgress) onProgress(f * 0.5f); });
+    return writeFileDurable(path, buf.bytes.data(), buf.size(),
+                            [&](float f){ if (onProgress) onProgress(0.5f + f * 0.5f); });
+}
+
+// ── SaveFileWriter ────────────────────────────────────────────────────────────
+bool SaveFileWriter::open(const std::string& path, uint32_t sectionCount) {
+    abort();
+    file = std::fopen((path + ".tmp").c_str(), "wb");
+    if (!file) return false;
+    finalPath = path;
+    reserved  = sectionCount;
+    inSection = false;
+    table.clear();
+    std::vector<uint8_t> blank(HEADER_BYTES + sectionCount * ENTRY_BYTES, 0);
+    ok  = std::fwrite(blank.data(), 1, blank.size(), file) == blank.size();
+    pos = blank.size();
+    return ok;
+}
+
+void SaveFileWriter::beginSection(uint32_t type, uint32_t flags) {
+    static const uint8_t pad[8] = {};
+    if (pos % 8) write(pad, 8 - pos % 8);
+    if (table.size() >= reserved) ok = false;
+    SaveSection s;
+    s.type    = type;
+    s.version = supportedVersion(type);
+    s.flags   = flags;
+    s.offset  = pos;
+    table.push_back(s);
+    inSection = true;
+}
+
+void SaveFileWriter::write(const void* data, size_t n) {
+    if (!file || n == 0) return;
+    ok  = ok && std::fwrite(data, 1, n, file) == n;
+    pos += n;
+    if (inSection) table.back().crc = crc32Update(table.back().crc, data, n);
+}
+
+void SaveFileWriter::endSection() {
+    if (!inSection) return;
+    table.back().length = pos - table.back().offset;
+    inSection = false;
+}
+
+bool SaveFileWriter::finish() {
+    if (!file) return false;
+    ByteWriter head;
+    writeHeaderAndTable(head, table);
+    ok = ok && seekFile(file, 0) && std::fwrite(head.bytes.data(), 1, head.size(), file) == head.size();
+    ok = ok && syncFile(file);
+    ok = (std::fclose(file) == 0) && ok;
+    file = nullptr;
+
+    std::string tmp = finalPath + ".tmp";
+    if (!ok) { std::remove(tmp.c_str()); return false; }
+    return replaceFile(tmp, finalPath);
+}
+
+void SaveFileWriter::abort() {
+    if (!file) return;
+    std::fclose(file);
+    file = nullptr;
+    std::remove((finalPath + ".tmp").c_str());
+}
+
+// ── In-memory decoding ────────────────────────────────────────────────────────
+bool decodeSectioned(const uint8_t* data, size_t size, WorldSnapshot& out) {
+    std::vector<SaveSection> table;
+    if (!parseSectionTable(data, size, table) || !tableLoadable(table)) return false;
+
+    auto payload = [&](uint32_t type, const uint8_t*& p, size_t& n) {
+        const SaveSection* s = findIn(table, type);
+        p = data + s->offset;
+        n = (size_t)s->length;
+        return crc32(p, n) == s->crc;
+    };
+
+    const uint8_t* p; size_t n;
+    SaveMeta meta;
+    if (!payload(SECTION_META, p, n)      || !decodeMeta(p, n, findIn(table, SECTION_META)->version, meta)) return false;
+    if (!payload(SECTION_SPECIES, p, n)   || !decodeSpecies(p, n, out.species))     return false;
+    if (!payload(SECTION_CREATURES, p, n) || !decodeCreatures(p, n, out.creatures)) return false;
+    if (!payload(SECTION_PLANTS, p, n)    || !decodePlants(p, n, out.plants))       return false;
+    out.simTime       = meta.simTime;
+    out.tickCount     = meta.tickCount;
+    out.nextID        = meta.nextID;
+    out.nextSpeciesID = meta.nextSpeciesID;
+    return true;
+}
+
+bool isSectionedSave(const std::string& path) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) return false;
+    char magic[4] = {};
+    bool ok = std::fread(magic, 1, 4, f) == 4 && std::memcmp(magic, "EVOX", 4) == 0;
+    std::fclose(f);
+    return ok;
+}
+
+// ── SaveFileReader ────────────────────────────────────────────────────────────
+bool SaveFileReader::open(const std::string& path) {
+    close();
+    std::error_code ec;
+    uint64_t fileSize = std::filesystem::file_size(path, ec);
+    if (ec) return false;
+    file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+
+    uint8_t hdr[HEADER_BYTES];
+    ContainerHeader h;
+    std::vector<uint8_t> raw;
+    bool ok = std::fread(hdr, 1, HEADER_BYTES, file) == HEADER_BYTES
+           && parseHeader(hdr, HEADER_BYTES, h);
+    if (ok) {
+        raw.resize((size_t)h.count * h.entryBytes);
+        ok = std::fread(raw.data(), 1, raw.size(), file) == raw.size()
+          && parseTable(raw.data(), raw.size(), h, fileSize, table);
+    }
+    if (!ok) close();
+    return ok;
+}
+
+void SaveFileReader::close() {
+    if (file) std::fclose(file);
+    file = nullptr;
+    table.clear();
+    plantSec   = nullptr;
+    plantsLeft = 0;
+    plantError = false;
+    plantBuf   = {};
+}
+
+const SaveSection* SaveFileReader::find(uint32_t type) const {
+    return findIn(table, type);
+}
+
+const SaveSection* SaveFileReader::usable(uint32_t type) const {
+    const SaveSection* s = find(type);
+    return sectionUsable(s) ? s : nullptr;
+}
+
+bool SaveFileReader::canLoadWorld() const {
+    return file && tableLoadable(table);
+}
+
+bool SaveFileReader::readSection(uint32_t type, std::vector<uint8_t>& out) {
+    const SaveSection* s = find(type);
+    if (!file || !s) return false;
+    out.resize((size_t)s->length);
+    return seekFile(file, s->offset)
+        && std::fread(out.data(), 1, out.size(), file) == out.size()
+        && crc32(out.data(), out.size()) == s->crc;
+}
+
+bool SaveFileReader::readMeta(SaveMeta& out) {
+    std::vector<uint8_t> buf;
+    return usable(SECTION_META) && readSection(SECTION_META, buf)
+        && decodeMeta(buf.data(), buf.size(), find(SECTION_META)->version, out);
+}
+
+bool SaveFileReader::readSummary(SaveSummary& out) {
+    std::vector<uint8_t> buf;
+    return usable(SECTION_SUMMARY) && readSection(SECTION_SUMMARY, buf)
+        && decodeSummary(buf.data(), buf.size(), out);
+}
+
+bool SaveFileReader::readSpecies(std::vector<SpeciesInfo>& out) {
+    std::vector<uint8_t> buf;
+    return usable(SECTION_SPECIES) && readSection(SECTION_SPECIES, buf)
+        && decodeSpecies(buf.data(), buf.size(), out);
+}
+
+bool SaveFileReader::readCreatures(std::vector<Creature>& out) {
+    std::vector<uint8_t> buf;
+    return usable(SECTION_CREATURES) && readSection(SECTION_CREATURES, buf)
+        && decodeCreatures(buf.data(), buf.size(), out);
+}
+
+bool SaveFileReader::readPlants(std::vector<Plant>& out) {
+    std::vector<uint8_t> buf;
+    return usable(SECTION_PLANTS) && readSection(SECTION_PLANTS, buf)
+        && decodePlants(buf.data(), buf.size(), out);
+}
+
+bool SaveFileReader::beginPlants() {
+    plantSec   = usable(SECTION_PLANTS);
+    plantsLeft = 0;
+    plantError = true;
+    if (!file || !plantSec || plantSec->length < 4 || !seekFile(file, plantSec->offset)) return false;
+
+    uint32_t count = 0;
+    if (std::fread(&count, sizeof(count), 1, file) != 1) return false;
+    if (4 + (uint64_t)count * PLANT_RECORD_BYTES != plantSec->length) return false;
+    plantCrc   = crc32(&count, sizeof(count));
+    plantsLeft = count;
+    plantError = false;
+    if (count == 0) plantError = plantCrc != plantSec->crc;
+    return !plantError;
+}
+
+size_t SaveFileReader::readPlantBatch(std::vector<Plant>& out, size_t max) {
+    if (plantError || plantsLeft == 0) return 0;
+    size_t n = std::min(max, plantsLeft);
+    plantBuf.resize(n * PLANT_RECORD_BYTES);
+    if (std::fread(plantBuf.data(), 1, plantBuf.size(), file) != plantBuf.size()) {
+        plantError = true;
+        return 0;
+    }
+    plantCrc = crc32Update(plantCrc, plantBuf.data(), plantBuf.size());
+    plantsLeft -= n;
+    if (plantsLeft == 0 && plantCrc != plantSec->crc) plantError = true;
+
+    ByteReader r(plantBuf.data(), plantBuf.size());
+    size_t at = out.size();
+    out.resize(at + n);
+    for (size_t i = 0; i < n; i++) readPlantRecord(r, out[at + i]);
+    return n;
+}
+
+// ── StreamingLoad ─────────────────────────────────────────────────────────────
+bool StreamingLoad::begin(const std::string& path, World& world) {
+    TRACE_SCOPE("Streaming load");
+    cancel();
+    error = false;
+
+    // Everything except plants is decoded before the live world is touched, so
+    // a bad file leaves the current world as it was.
+    WorldSnapshot snap;
+    SaveMeta      meta;
+    if (!reader.open(path) || !reader.canLoadWorld() || !reader.readMeta(meta) ||
+        !reader.readSpecies(snap.species) || !reader.readCreatures(snap.creatures) ||
+        !reader.beginPlants()) {
+        reader.close();
+        error = true;
+        return false;
+    }
+    snap.simTime       = meta.simTime;
+    snap.tickCount     = meta.tickCount;
+    snap.nextID        = meta.nextID;
+    snap.nextSpeciesID = meta.nextSpeciesID;
+    world.restoreSnapshot(snap);
+    world.plants.reserve(reader.plantsRemaining());
+
+    totalPlants = reader.plantsRemaining();
+    streaming   = true;
+    step(world);   // first batch now, so small saves finish immediately
+    return true;
+}
+
+bool StreamingLoad::step(World& world) {
+    if (!streaming) return false;
+    TRACE_SCOPE("Streaming load step");
+    reader.readPlantBatch(world.plants, std::max<size_t>(plantsPerStep, 1));
+    if (reader.plantsRemaining() > 0 && !reader.plantsFailed()) return true;
+
+    error     = reader.plantsFailed();
+    streaming = false;
+    reader.close();
+    if (error) world.plants.clear();   // unverified; see World_Sections.hpp
+    return false;
+}
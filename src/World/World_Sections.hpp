@@ -0,0 +1,240 @@
+#pragma once
+// ── World_Sections.hpp ────────────────────────────────────────────────────────
+// Sectioned save container ("EVOX").
+//
+// The file opens with a small header and a table of sections; each section is
+// an independently versioned, CRC-32 checked payload at a known offset. Readers
+// open the table only and then fetch just the sections they need, so a tool can
+// show the summary or species registry of a multi-GB save without touching the
+// creature data, and the game can restore creatures first and stream plants in
+// over the following frames.
+//
+// Forward compatibility: a reader skips sections whose type it doesn't know or
+// whose version is newer than it understands – unless the section is flagged
+// SECTION_REQUIRED, in which case the file is refused. Table entries carry
+// their own size so later versions can append fields to them.
+//
+// File layout:
+//   [4]  magic "EVOX"
+//   [4]  container version uint32 = 1
+//   [4]  section count uint32
+//   [4]  table entry size uint32 (32 for v1)
+//   [4]  table CRC-32 uint32 (over all entries)
+//   [4]  reserved uint32
+//   per section: type uint32 (FourCC), version uint32, offset uint64,
+//                length uint64, crc32 uint32, flags uint32
+//   payloads, each starting on an 8-byte boundary
+//
+// Sections written by this version (payloads use the record codecs in
+// World_Snapshot.hpp):
+//   META v2  simTime float, nextID uint32, nextSpeciesID uint32,
+//            creature/plant/species counts uint32×3,
+//            tickCount uint64 (v2; v1 ends before it)           (required)
+//   SUMM v1  SaveSummary fields in declaration order             (optional)
+//   SPEC v1  count uint32 + species records                      (required)
+//   CRTR v1  count uint32 + creature records                     (required)
+//   PLNT v1  count uint32 + plant records                        (required)
+
+#include "World_Snapshot.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+constexpr uint32_t sectionTag(const char (&s)[5]) {
+    return (uint32_t)(uint8_t)s[0]         | (uint32_t)(uint8_t)s[1] << 8
+         | (uint32_t)(uint8_t)s[2] << 16   | (uint32_t)(uint8_t)s[3] << 24;
+}
+
+constexpr uint32_t SECTION_META      = sectionTag("META");
+constexpr uint32_t SECTION_SUMMARY   = sectionTag("SUMM");
+constexpr uint32_t SECTION_SPECIES   = sectionTag("SPEC");
+constexpr uint32_t SECTION_CREATURES = sectionTag("CRTR");
+constexpr uint32_t SECTION_PLANTS    = sectionTag("PLNT");
+
+constexpr uint32_t SECTION_REQUIRED  = 1u << 0;   // readers must understand it to load the world
+
+struct SaveSection {
+    uint32_t type    = 0;
+    uint32_t version = 0;
+    uint64_t offset  = 0;   // absolute file offset of the payload
+    uint64_t length  = 0;   // payload bytes
+    uint32_t crc     = 0;   // CRC-32 of the payload
+    uint32_t flags   = 0;
+};
+
+std::string sectionTagName(uint32_t type);   // "CRTR" etc. for display
+
+// World-level counters, enough to size allocations before loading entities
+struct SaveMeta {
+    float    simTime       = 0.f;
+    EntityID nextID        = 1;
+    uint32_t nextSpeciesID = 1;
+    uint32_t creatures     = 0;
+    uint32_t plants        = 0;
+    uint32_t species       = 0;
+    uint64_t tickCount     = 0;
+};
+
+// Precomputed at save time so browsers never need to decode creatures
+struct SaveSummary {
+    float    simTime       = 0.f;
+    uint32_t population    = 0;
+    uint32_t herbivores    = 0;
+    uint32_t carnivores    = 0;
+    uint32_t speciesAlive  = 0;   // species with at least one living member
+    uint32_t speciesTotal  = 0;
+    uint32_t plantsAlive   = 0;
+    uint32_t maxGeneration = 0;
+    float    avgGeneration = 0.f;
+    float    avgSpeed      = 0.f;
+    float    avgSize       = 0.f;
+    float    avgEnergy     = 0.f;
+};
+
+// Accumulates a SaveSummary one entity at a time, for writers that stream
+// records instead of holding a whole snapshot
+struct SummaryBuilder {
+    void add(const Creature& c);
+    void add(const Plant& p)        { if (p.alive) s.plantsAlive++; }
+    void add(const SpeciesInfo& sp) { s.speciesTotal++; if (sp.count > 0) s.speciesAlive++; }
+    void merge(const SummaryBuilder& o);   // combine per-thread partial sums
+    SaveSummary finish(float simTime);
+
+private:
+    SaveSummary s;
+    double sumGen = 0, sumSpeed = 0, sumSize = 0, sumEnergy = 0;
+};
+
+SaveSummary summarizeSnapshot(const WorldSnapshot& snap);
+
+// META and SUMM payload codecs
+void writeMetaRecord   (ByteWriter& w, const SaveMeta& m);
+void writeSummaryRecord(ByteWriter& w, const SaveSummary& s);
+
+// ── Writing ───────────────────────────────────────────────────────────────────
+// Only alive creatures are written, as in the EVOS encoder.
+void encodeSectioned(const WorldSnapshot& snap, ByteWriter& out,
+                     const std::function<void(float)>& onProgress = {});
+bool writeSectionedFile(const WorldSnapshot& snap, const std::string& path,
+                        const std::function<void(float)>& onProgress = {});
+
+// Streaming writer for tools that produce saves larger than memory. Sections
+// are appended in order; the table is written last, then the file is fsync'd
+// and renamed into place as with writeFileDurable.
+struct SaveFileWriter {
+    SaveFileWriter() = default;
+    SaveFileWriter(const SaveFileWriter&) = delete;
+    SaveFileWriter& operator=(const SaveFileWriter&) = delete;
+    ~SaveFileWriter() { abort(); }
+
+    bool open(const std::string& path, uint32_t sectionCount);
+    void beginSection(uint32_t type, uint32_t flags);
+    void write(const void* data, size_t n);
+    void write(const ByteWriter& w) { write(w.bytes.data(), w.size()); }
+    void endSection();
+    bool finish();   // false on any I/O error since open()
+    void abort();    // discard the partial file
+
+private:
+    std::FILE*               file = nullptr;
+    std::string              finalPath;
+    std::vector<SaveSection> table;
+    uint32_t                 reserved  = 0;   // table slots allocated at open()
+    uint64_t                 pos       = 0;
+    bool                     inSection = false;
+    bool                     ok        = false;
+};
+
+// Decode a whole in-memory EVOX image (readSnapshotFile dispatches here)
+bool decodeSectioned(const uint8_t* data, size_t size, WorldSnapshot& out);
+
+// Parse and validate the header and table of an in-memory (e.g. mapped) EVOX
+// image. Payload checksums are not verified here.
+bool parseSectionTable(const uint8_t* data, size_t size, std::vector<SaveSection>& out);
+
+// Present, and of a version this build can decode
+bool sectionUsable(const SaveSection* s);
+
+// ── Reading ───────────────────────────────────────────────────────────────────
+// Random access to the sections of a file on disk. open() reads only the
+// header and table; every other call reads exactly one section and verifies
+// its checksum.
+struct SaveFileReader {
+    SaveFileReader() = default;
+    SaveFileReader(const SaveFileReader&) = delete;
+    SaveFileReader& operator=(const SaveFileReader&) = delete;
+    ~SaveFileReader() { close(); }
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+
+    const std::vector<SaveSection>& sections() const { return table; }
+    const SaveSection* find(uint32_t type) const;
+
+    // False when a required section is missing or from a newer format version
+    bool canLoadWorld() const;
+
+    // Raw payload, checksum-verified
+    bool readSection(uint32_t type, std::vector<uint8_t>& out);
+
+    bool readMeta     (SaveMeta& out);
+    bool readSummary  (SaveSummary& out);
+    bool readSpecies  (std::vector<SpeciesInfo>& out);
+    bool readCreatures(std::vector<Creature>& out);
+    bool readPlants   (std::vector<Plant>& out);
+
+    // ── Incremental plant access ──────────────────────────────────────────────
+    // beginPlants() positions at the first plant record; readPlantBatch() then
+    // decodes up to `max` records per call and returns how many it appended
+    // (0 = finished or failed). The checksum is accumulated as records stream
+    // by and checked after the last batch; plantsFailed() reports the outcome.
+    bool   beginPlants();
+    size_t readPlantBatch(std::vector<Plant>& out, size_t max);
+    size_t plantsRemaining() const { return plantsLeft; }
+    bool   plantsFailed() const    { return plantError; }
+
+private:
+    std::FILE*               file = nullptr;
+    std::vector<SaveSection> table;
+
+    const SaveSection* usable(uint32_t type) const;   // present and version supported
+
+    // Plant stream state
+    const SaveSection*   plantSec   = nullptr;
+    uint32_t             plantCrc   = 0;
+    size_t               plantsLeft = 0;
+    bool                 plantError = false;
+    std::vector<uint8_t> plantBuf;
+};
+
+// True if the file starts with the EVOX magic
+bool isSectionedSave(const std::string& path);
+
+// ── Two-phase load into a live World ──────────────────────────────────────────
+// begin() replaces the world's creatures and species and clears its plants;
+// step() then appends plants in bounded batches, one call per frame. The world
+// stays consistent at every step (it simply has fewer plants until done), so
+// rendering and even ticking may continue during the stream.
+// The plant section's CRC can only be checked once the last batch is read. If
+// it fails (or a read does), the streamed plants are unverified and are
+// dropped: the world keeps the loaded creatures and species with no plants,
+// which regrow, and failed() reports it. Anything that replaces the world
+// while a load streams must cancel() it first.
+struct StreamingLoad {
+    size_t plantsPerStep = 1 << 16;
+
+    bool begin(const std::string& path, World& world);
+    bool step(World& world);              // true while plants remain
+    void cancel()          { reader.close(); streaming = false; }
+
+    bool  active() const   { return streaming; }
+    bool  failed() const   { return error; }
+    float progress() const { return totalPlants ? 1.f - (float)reader.plantsRemaining() / totalPlants : 1.f; }
+
+private:
+    SaveFileReader reader;
+    bool           streaming   = false;
+    bool           error       = false;
+    size_t         totalPlants = 0;
+};
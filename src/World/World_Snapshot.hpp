@@ -0,0 +1,64 @@
+#pragma once
+// ── World_Snapshot.hpp ────────────────────────────────────────────────────────
+// A self-contained copy of everything that defines the simulation state.
+//
+// Capturing a snapshot copies the entity vectors: Creature and Plant are
+// trivially copyable, so those two copy as contiguous blocks, while species
+// entries carry a name string and are copied one by one. A snapshot that is
+// reused keeps its capacity, so only a growing world makes it reallocate.
+// That is cheap enough to do at a tick boundary on the main thread. The
+// expensive part – encoding to the binary save format and writing it to
+// disk – can then run on a worker thread without touching the live World.
+
+#include "World.hpp"
+#include "Core/ByteStream.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+struct WorldSnapshot {
+    float    simTime       = 0.f;
+    uint64_t tickCount     = 0;
+    EntityID nextID        = 1;
+    uint32_t nextSpeciesID = 1;
+
+    std::vector<Creature>    creatures;
+    std::vector<Plant>       plants;
+    std::vector<SpeciesInfo> species;
+};
+
+// ── Save-format record codecs (see World_IO.cpp for the layout) ───────────────
+// Byte sizes of the fixed-length records; species records carry a name string
+// and are therefore variable length.
+constexpr size_t CREATURE_RECORD_BYTES =
+    sizeof(uint32_t) * 5                         // id, parents, generation, speciesID
+  + sizeof(float) * 7                            // pos, vel, yaw
+  + sizeof(float) * GENOME_SIZE                  // genome
+  + sizeof(float) * DRIVE_COUNT * 3              // urgency, craveRate, desireMult
+  + sizeof(float) * 5                            // energy … mass
+  + sizeof(uint32_t) + sizeof(float) + sizeof(uint32_t);  // behavior, gestTimer, mateTarget
+constexpr size_t PLANT_RECORD_BYTES = sizeof(float) * 5 + 2;
+constexpr size_t SPECIES_RECORD_MIN_BYTES =      // an unnamed species
+    sizeof(uint32_t) * 3                         // id, count, allTime
+  + sizeof(float) * (3 + GENOME_SIZE)            // color, centroid
+  + sizeof(uint32_t);                            // nameLen
+
+void writeCreatureRecord(ByteWriter& w, const Creature& c);
+void readCreatureRecord (ByteReader& r, Creature& c);
+void writePlantRecord   (ByteWriter& w, const Plant& p);
+void readPlantRecord    (ByteReader& r, Plant& p);
+void writeSpeciesRecord (ByteWriter& w, const SpeciesInfo& sp);
+void readSpeciesRecord  (ByteReader& r, SpeciesInfo& sp);
+
+// ── Whole-snapshot encoding ("EVOS" v3) ───────────────────────────────────────
+// `onProgress` (optional) receives the encoded fraction in [0,1].
+void encodeSnapshot(const WorldSnapshot& snap, ByteWriter& out,
+                    const std::function<void(float)>& onProgress = {});
+bool decodeSnapshot(const uint8_t* data, size_t size, WorldSnapshot& out);
+
+// Encode and write durably (tmp file + fsync + rename). Progress covers both
+// the encode (first half) and the disk write (second half).
+bool writeSnapshotFile(const WorldSnapshot& snap, const std::string& path,
+                       const std::function<void(float)>& onProgress = {});
+// Reads either format: EVOS, or the sectioned EVOX container (World_Sections.hpp).
+bool readSnapshotFile(const std::string& path, WorldSnapshot& out);
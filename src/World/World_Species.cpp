@@ -44,6 +44,13 @@ uint32_t World::classifySpecies(const Genome& g) {
         sp.name = std::string(parts[sp.id % 8]) + std::to_string(sp.id);
 
         species.push_back(sp);
+        events.speciations++;
+
+        SimEvent e;
+        e.type      = SimEventType::SpeciesFormed;
+        e.simTime   = simTime;
+        e.speciesID = sp.id;
+        eventBus.publish(e);
         return sp.id;
     }
 
@@ -56,29 +63,51 @@ uint32_t World::classifySpecies(const Genome& g) {
 
 // Recompute each species' centroid genome by averaging all living members' raw genes.
 // Also resets and recounts species populations. Called every 5 simulated seconds
-// (not every tick) to amortise the O(creatures + species) cost.
+// (not every tick) to amortise the O(creatures + species) cost. Members find
+// their species through an ID-indexed slot table rather than a search, so the
+// pass stays linear however many species have ever existed. Species that had
+// members going in and have none coming out are published as extinct.
 void World::updateSpeciesCentroids() {
     // Zero all counts and centroid accumulators
-    for (auto& sp : species) {
+    speciesSlot.assign(nextSpeciesID, -1);
+    speciesWasLive.clear();
+    for (size_t i = 0; i < species.size(); i++) {
+        auto& sp = species[i];
+        if (sp.count > 0) speciesWasLive.push_back((uint32_t)i);
         sp.count = 0;
         sp.centroid = Genome{};   // zeroed raw array
+        if (sp.id < speciesSlot.size()) speciesSlot[sp.id] = (int32_t)i;
     }
     // Sum genome values per species
     for (const auto& c : creatures) {
-        if (!c.alive) continue;
-        auto it = std::find_if(species.begin(), species.end(),
-                               [&](const SpeciesInfo& s){ return s.id == c.speciesID; });
-        if (it == species.end()) continue;
-        it->count++;
+        if (!c.alive || c.speciesID >= speciesSlot.size()) continue;
+        int32_t slot = speciesSlot[c.speciesID];
+        if (slot < 0) continue;
+        SpeciesInfo& sp = species[slot];
+        sp.count++;
         for (int i = 0; i < GENOME_SIZE; i++)
-            it->centroid.raw[i] += c.genome.raw[i];
+            sp.centroid.raw[i] += c.genome.raw[i];
     }
     // Divide by count to get the mean genome per species
-    for (auto& sp : species) {
+    liveSpecies.clear();
+    for (size_t s = 0; s < species.size(); s++) {
+        auto& sp = species[s];
         if (sp.count == 0) continue;
         for (int i = 0; i < GENOME_SIZE; i++)
             sp.centroid.raw[i] /= sp.count;
+        liveSpecies.push_back((uint32_t)s);
+    }
+    for (uint32_t s : speciesWasLive) {
+        const SpeciesInfo& sp = species[s];
+        if (sp.count > 0) continue;
+        SimEvent e;
+        e.type      = SimEventType::SpeciesExtinct;
+        e.simTime   = simTime;
+        e.speciesID = sp.id;
+        e.count     = (uint32_t)sp.allTime;
+        eventBus.publish(e);
     }
+    speciesUpdates++;
 }
 
 const SpeciesInfo* World::getSpecies(uint32_t id) const {
@@ -1,9 +1,10 @@
 #include "World.hpp"
 #include "World_Planet.hpp"
+#include "Core/Profiler.hpp"
 #include "tracy/Tracy.hpp"
 
 // ── Reproduction ──────────────────────────────────────────────────────────────
-void World::handleReproduction(float dt) {
+void World::handleReproduction(float dt, TickCounters& counters) {
     // Advance gestation timers; spawn offspring when timer expires
     ZoneScoped;
     for (auto& c : creatures) {
@@ -16,15 +17,16 @@ void World::handleReproduction(float dt) {
             if (!mate.alive) { c.behavior = BehaviorState::Idle; continue; }
 
             // Crossover + mutate to produce each offspring's genome
+            CounterRNG rng = rngFor(c.id, RNG_BIRTH);
             int litter = c.genome.litterSize();
             for (int i = 0; i < litter; i++) {
-                Genome child = Genome::crossover(c.genome, mate.genome, globalRNG());
-                child.mutate(globalRNG());
+                Genome child = Genome::crossover(c.genome, mate.genome, rng);
+                child.mutate(rng);
 
                 // Scatter offspring around the mother, snapped to the planet surface
                 Vec3 birthPos = c.pos;
-                birthPos.x += globalRNG().range(-100.f, 100.f);
-                birthPos.z += globalRNG().range(-100.f, 100.f);
+                birthPos.x += rng.range(-100.f, 100.f);
+                birthPos.z += rng.range(-100.f, 100.f);
                 birthPos = g_planet_surface.snapToSurface(birthPos);
 
                 if ((int)creatures.size() < cfg.maxPopulation)
@@ -52,10 +54,10 @@ void World::handleReproduction(float dt) {
         if (it == idToIndex.end()) continue;
         Creature& mate = creatures[it->second];
         if (!mate.alive) continue;
-        if (mate.behavior == BehaviorState::Mating) continue;
+        if (mate.behavior == BehaviorState::Mating) { counters.mateRejections++; continue; }
 
         // Final genetic gate: genomes must be within the species epsilon to reproduce
-        if (!sameSpecies(c.genome, mate.genome, cfg.speciesEpsilon)) continue;
+        if (!sameSpecies(c.genome, mate.genome, cfg.speciesEpsilon)) { counters.mateRejections++; continue; }
 
         // Begin gestation; only the mother (c) tracks the timer
         c.behavior   = BehaviorState::Mating;
@@ -64,34 +66,117 @@ void World::handleReproduction(float dt) {
     }
 }
 
+// ── Population alerts ─────────────────────────────────────────────────────────
+// O(1) per tick: the population is the creature count right after
+// removeDeadCreatures(), and die-offs are measured from this tick's removals.
+void World::publishEvents(const TickCounters& counters) {
+    uint32_t pop = (uint32_t)creatures.size();
+    SimEvent e;
+    e.simTime = simTime;
+    e.count   = pop;
+
+    if (!popLow && pop > 0 && pop < alerts.lowPopulation) {
+        popLow = true;
+        e.type = SimEventType::PopulationLow;
+        eventBus.publish(e);
+    } else if (popLow && pop >= alerts.recoverPopulation) {
+        popLow = false;
+        e.type = SimEventType::PopulationRecovered;
+        eventBus.publish(e);
+    }
+
+    uint32_t boomAt = (uint32_t)std::max(1.f, alerts.boomFraction * cfg.maxPopulation);
+    if (!popBoom && pop >= boomAt) {
+        popBoom = true;
+        e.type  = SimEventType::PopulationBoom;
+        e.limit = (uint32_t)cfg.maxPopulation;
+        eventBus.publish(e);
+    } else if (popBoom && pop < boomAt * 0.8f) {
+        popBoom = false;
+    }
+
+    // Windows restart when they expire, fire, or time runs backwards (loads)
+    if (simTime < dieOffStart || simTime - dieOffStart >= alerts.dieOffWindow) {
+        dieOffStart  = simTime;
+        dieOffPop    = pop + counters.removed;
+        dieOffDeaths = 0;
+    }
+    dieOffDeaths += counters.removed;
+    if (dieOffDeaths >= alerts.dieOffMinDeaths
+        && dieOffDeaths > alerts.dieOffFraction * dieOffPop) {
+        e.type   = SimEventType::MassDieOff;
+        e.count  = dieOffDeaths;
+        e.limit  = dieOffPop;
+        e.window = simTime - dieOffStart;
+        eventBus.publish(e);
+        dieOffStart  = simTime;
+        dieOffPop    = pop;
+        dieOffDeaths = 0;
+    }
+}
+
 // ── Main tick ─────────────────────────────────────────────────────────────────
 void World::tick(float dt) {
     ZoneScoped;
     if (cfg.paused) return;
+    PROFILE_SCOPE(PROF_TICK);
     dt *= cfg.simSpeed;   // apply time-scale multiplier
 
     simTime += dt;
+    tickCount++;
 
-    growPlants(dt);
-    rebuildSpatialHash();  // must happen before perceive() queries
+    {
+        PROFILE_SCOPE(PROF_TICK_PLANTS);
+        growPlants(dt);
+    }
+    {
+        PROFILE_SCOPE(PROF_TICK_SPATIAL);
+        rebuildSpatialHash();  // must happen before perceive() queries
+    }
 
     // Two-pass update: perceive first (read-only world scan), then act (writes).
     // Separating the passes ensures a creature can't react to changes made by
     // another creature in the same tick (fair simultaneous update semantics).
-    for (auto& c : creatures)
-        if (c.alive) perceive(c, dt);
+    bool sampleCosts = costs.beginTick(creatures.size());
+    {
+        PROFILE_SCOPE(PROF_TICK_PERCEIVE);
+        if (sampleCosts) perceiveSampled(dt);
+        else
+            for (auto& c : creatures)
+                if (c.alive) perceive(c, dt);
+    }
 
-    for (auto& c : creatures)
-        if (c.alive) c.tick(dt, *this);
+    // Act pass tallies into its own block; a split pass would give each
+    // worker one and merge them here
+    TickCounters counters;
+    {
+        PROFILE_SCOPE(PROF_TICK_ACT);
+        if (sampleCosts) actSampled(dt, counters);
+        else
+            for (auto& c : creatures)
+                if (c.alive) c.tick(dt, *this, counters);
+    }
 
-    handleReproduction(dt);
-    removeDeadCreatures();
+    uint64_t birthsBefore = events.births, deathsBefore = events.deaths;
+    {
+        PROFILE_SCOPE(PROF_TICK_REPRODUCE);
+        handleReproduction(dt, counters);
+    }
+    {
+        PROFILE_SCOPE(PROF_TICK_CLEANUP);
+        removeDeadCreatures();
+    }
+    counters.births  = (uint32_t)(events.births - birthsBefore);
+    counters.removed = (uint32_t)(events.deaths - deathsBefore);
+    events.add(counters);
+    lastTick = counters;
+    publishEvents(counters);
 
     // Update species centroids periodically (not every tick for performance)
-    static float spTimer = 0.f;
-    spTimer += dt;
-    if (spTimer > 5.f) {
+    speciesTimer += dt;
+    if (speciesTimer > 5.f) {
+        PROFILE_SCOPE(PROF_TICK_SPECIES);
         updateSpeciesCentroids();
-        spTimer = 0.f;
+        speciesTimer = 0.f;
     }
 }